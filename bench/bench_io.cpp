@@ -0,0 +1,97 @@
+/**
+ * @file bench_io.cpp
+ * @brief Benchmarks of saving, loading, mapping and streaming of the binary
+ * files of vectors and matrices. The files are written to the temporary
+ * directory.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
+#include "basic_io.h"
+#include "basic_stream.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the benchmarks of files.
+ */
+
+namespace {
+
+/// @brief Path of temporary file `name`.
+std::string temporary(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/// @brief Saves the vector of `length` ones to the temporary file `name`.
+std::string make_file(const std::string &name, size_t length) {
+  const std::string path = temporary(name);
+  bez::save(path, bez::basic_vector<double>(length, 1.0));
+  return path;
+}
+
+void set_bytes(benchmark::State &state) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(0) * sizeof(double));
+}
+
+void BM_save(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const bez::basic_vector<double> vector(length, 1.0);
+  const std::string path = temporary("bez_bench_save.bez");
+  for (auto _ : state) benchmark::DoNotOptimize(bez::save(path, vector));
+  set_bytes(state);
+  std::filesystem::remove(path);
+}
+
+void BM_load(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const std::string path = make_file("bez_bench_load.bez", length);
+  bez::basic_vector<double> vector(length, bez::uninitialized);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bez::load(path, vector));
+    benchmark::DoNotOptimize(vector.data());
+  }
+  set_bytes(state);
+  std::filesystem::remove(path);
+}
+
+void BM_mapped_sum(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const std::string path = make_file("bez_bench_mapped.bez", length);
+  for (auto _ : state) {
+    bez::mapped_file file(path);
+    benchmark::DoNotOptimize(file.vector<double>().sum());
+  }
+  set_bytes(state);
+  std::filesystem::remove(path);
+}
+
+void BM_stream_sum(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const std::string path = make_file("bez_bench_stream.bez", length);
+  double total = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bez::stream_sum(path, total, length / 8 + 1));
+    benchmark::DoNotOptimize(total);
+  }
+  set_bytes(state);
+  std::filesystem::remove(path);
+}
+
+}  // namespace
+
+BENCHMARK(BM_save)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_load)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_mapped_sum)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_stream_sum)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,140 @@
+/**
+ * @file bench_matrix.cpp
+ * @brief Benchmarks of the product, element-wise operations and comparisons
+ * of basic_matrix.
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "basic_fixed.h"
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the benchmarks of matrices.
+ * * 2026-10-14 V0.2 Added `BM_gemm` of the micro-kernels.
+ */
+
+namespace {
+
+/// @brief Matrix of `rows` x `columns` elements 1, 2, ... modulo 13.
+template <typename T>
+bez::basic_matrix<T> make_matrix(size_t rows, size_t columns) {
+  bez::basic_matrix<T> matrix(rows, columns, bez::uninitialized);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++)
+      matrix.set(i, j, static_cast<T>((i * columns + j) % 13 + 1));
+  return matrix;
+}
+
+/// @brief Reports the operations of product of `n` x `n` matrices per second.
+void set_flops(benchmark::State &state, size_t n) {
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * static_cast<double>(n) * static_cast<double>(n) *
+          static_cast<double>(n),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename T>
+void BM_multiply(benchmark::State &state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto a = make_matrix<T>(n, n), b = make_matrix<T>(n, n);
+  for (auto _ : state) {
+    bez::basic_matrix<T> c = a * b;
+    benchmark::DoNotOptimize(c.data());
+  }
+  set_flops(state, n);
+}
+
+/// @brief Blocked product by gemm() without the allocation of the result,
+/// which measures the micro-kernel of the active instruction set.
+template <typename T>
+void BM_gemm(benchmark::State &state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto a = make_matrix<T>(n, n), b = make_matrix<T>(n, n);
+  bez::basic_matrix<T> c(n, n);
+  for (auto _ : state) {
+    bez::gemm(n, n, n, a.data(), a.stride(), b.data(), b.stride(), c.data(),
+              c.stride());
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  set_flops(state, n);
+}
+
+template <typename T>
+void BM_add(benchmark::State &state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto a = make_matrix<T>(n, n), b = make_matrix<T>(n, n);
+  bez::basic_matrix<T> c(n, n, bez::uninitialized);
+  for (auto _ : state) {
+    c = a + b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * n *
+                          3 * sizeof(T));
+}
+
+template <typename T>
+void BM_transpose(benchmark::State &state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto a = make_matrix<T>(n, n);
+  for (auto _ : state) {
+    bez::basic_matrix<T> c(a.transpose());
+    benchmark::DoNotOptimize(c.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * n *
+                          2 * sizeof(T));
+}
+
+template <typename T>
+void BM_equal(benchmark::State &state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto a = make_matrix<T>(n, n), b = make_matrix<T>(n, n);
+  for (auto _ : state) benchmark::DoNotOptimize(a == b);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * n *
+                          2 * sizeof(T));
+}
+
+template <typename T, size_t N>
+void BM_fixed_multiply(benchmark::State &state) {
+  auto a = bez::basic_matrix<T, N, N>::identity();
+  const auto b = bez::basic_matrix<T, N, N>::identity();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    a = a * b;
+  }
+  set_flops(state, N);
+}
+
+}  // namespace
+
+#define BEZ_BENCH_TYPES(NAME, LO, HI)                                  \
+  BENCHMARK_TEMPLATE(NAME, float)->RangeMultiplier(2)->Range(LO, HI);  \
+  BENCHMARK_TEMPLATE(NAME, double)->RangeMultiplier(2)->Range(LO, HI); \
+  BENCHMARK_TEMPLATE(NAME, int)->RangeMultiplier(2)->Range(LO, HI)
+
+BEZ_BENCH_TYPES(BM_multiply, 4, 512);
+BEZ_BENCH_TYPES(BM_add, 16, 1024);
+BEZ_BENCH_TYPES(BM_transpose, 16, 1024);
+BEZ_BENCH_TYPES(BM_equal, 16, 1024);
+
+BENCHMARK_TEMPLATE(BM_gemm, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_gemm, double)->RangeMultiplier(4)->Range(64, 1024);
+
+BENCHMARK_TEMPLATE(BM_fixed_multiply, float, 4);
+BENCHMARK_TEMPLATE(BM_fixed_multiply, double, 3);
+BENCHMARK_TEMPLATE(BM_fixed_multiply, double, 8);
+
+#undef BEZ_BENCH_TYPES
@@ -0,0 +1,183 @@
+/**
+ * @file bench_vector.cpp
+ * @brief Benchmarks of construction, element-wise operations, reductions and
+ * comparisons of basic_vector.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "basic_fixed.h"
+#include "basic_vector.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the benchmarks of vectors.
+ */
+
+namespace {
+
+/// @brief Vector of `length` elements 1, 2, ... modulo 97.
+template <typename T>
+bez::basic_vector<T> make_vector(size_t length) {
+  bez::basic_vector<T> vector(length, bez::uninitialized);
+  for (size_t i = 0; i < length; i++)
+    vector.set(static_cast<T>(i % 97 + 1), i);
+  return vector;
+}
+
+template <typename T>
+void set_bytes(benchmark::State &state, size_t arrays) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          state.range(0) * arrays * sizeof(T));
+}
+
+template <typename T>
+void BM_construct(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    bez::basic_vector<T> vector(length);
+    benchmark::DoNotOptimize(vector.data());
+  }
+  set_bytes<T>(state, 1);
+}
+
+template <typename T>
+void BM_construct_uninitialized(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    bez::basic_vector<T> vector(length, bez::uninitialized);
+    benchmark::DoNotOptimize(vector.data());
+  }
+}
+
+template <typename T>
+void BM_copy(benchmark::State &state) {
+  const auto source = make_vector<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    bez::basic_vector<T> vector = source;
+    benchmark::DoNotOptimize(vector.data());
+  }
+  set_bytes<T>(state, 2);
+}
+
+template <typename T>
+void BM_add(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const auto a = make_vector<T>(length), b = make_vector<T>(length);
+  bez::basic_vector<T> c(length, bez::uninitialized);
+  for (auto _ : state) {
+    c = a + b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  set_bytes<T>(state, 3);
+}
+
+template <typename T>
+void BM_fused(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const auto a = make_vector<T>(length), b = make_vector<T>(length);
+  bez::basic_vector<T> c(length, bez::uninitialized);
+  for (auto _ : state) {
+    c = a * T(2) + b - a;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  set_bytes<T>(state, 3);
+}
+
+template <typename T>
+void BM_scale(benchmark::State &state) {
+  auto a = make_vector<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    a *= T(1);
+    benchmark::DoNotOptimize(a.data());
+    benchmark::ClobberMemory();
+  }
+  set_bytes<T>(state, 2);
+}
+
+template <typename T>
+void BM_sum(benchmark::State &state) {
+  auto a = make_vector<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(a.sum());
+  set_bytes<T>(state, 1);
+}
+
+template <typename T>
+void BM_dot(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  auto a = make_vector<T>(length), b = make_vector<T>(length);
+  for (auto _ : state) benchmark::DoNotOptimize(a.dot(b));
+  set_bytes<T>(state, 2);
+}
+
+template <typename T>
+void BM_norm(benchmark::State &state) {
+  auto a = make_vector<T>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(a.norm());
+  set_bytes<T>(state, 1);
+}
+
+template <typename T>
+void BM_equal(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const auto a = make_vector<T>(length), b = make_vector<T>(length);
+  for (auto _ : state) benchmark::DoNotOptimize(a == b);
+  set_bytes<T>(state, 2);
+}
+
+template <typename T>
+void BM_multiset_equal(benchmark::State &state) {
+  const auto length = static_cast<size_t>(state.range(0));
+  const auto a = make_vector<T>(length);
+  bez::basic_vector<T> b(length, bez::uninitialized);
+  for (size_t i = 0; i < length; i++) b.set(a[length - 1 - i], i);
+  for (auto _ : state) benchmark::DoNotOptimize(bez::multiset_equal(a, b));
+  set_bytes<T>(state, 2);
+}
+
+template <typename T, size_t N>
+void BM_fixed_add(benchmark::State &state) {
+  bez::basic_vector<T, N> a(T(1)), b(T(2));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    a = a + b;
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * N * 3 *
+                          sizeof(T));
+}
+
+}  // namespace
+
+#define BEZ_BENCH_TYPES(NAME, LO, HI)                                  \
+  BENCHMARK_TEMPLATE(NAME, float)->RangeMultiplier(8)->Range(LO, HI);  \
+  BENCHMARK_TEMPLATE(NAME, double)->RangeMultiplier(8)->Range(LO, HI); \
+  BENCHMARK_TEMPLATE(NAME, int)->RangeMultiplier(8)->Range(LO, HI)
+
+BEZ_BENCH_TYPES(BM_construct, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_construct_uninitialized, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_copy, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_add, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_fused, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_scale, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_sum, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_dot, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_norm, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_equal, 8, 1 << 21);
+BEZ_BENCH_TYPES(BM_multiset_equal, 8, 1 << 18);
+
+BENCHMARK_TEMPLATE(BM_fixed_add, float, 4);
+BENCHMARK_TEMPLATE(BM_fixed_add, double, 3);
+BENCHMARK_TEMPLATE(BM_fixed_add, double, 16);
+
+#undef BEZ_BENCH_TYPES
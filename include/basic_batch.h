@@ -0,0 +1,371 @@
+/**
+ * @file basic_batch.h
+ * @brief Implements the multiplication of many small matrices of the same
+ * shape by one call. The products are spread over the threads, and the
+ * matrices stored interleaved are multiplied in the vector registers across
+ * the batch, so each lane of register computes its own product.
+ * @code
+ * bez::matrix_batch<float> a(count, 4, 4), b(count, 4, 4), c(count, 4, 4);
+ * ...
+ * multiply(a, b, c);  // c[p] = a[p] * b[p], found by the arguments
+ * @endcode
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_BATCH
+#define BASIC_BATCH
+
+#include <algorithm>
+#include <cstddef>
+#include <concepts>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "basic_fixed.h"
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_vector.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the strided and interleaved batches of
+ *   products and `matrix_batch`.
+ */
+
+namespace bez {
+
+namespace detail {
+
+/// @brief Products of one range of parallel computation of batch.
+inline size_t batch_grain(size_t m, size_t n, size_t k) {
+  return std::max<size_t>(1, (size_t{1} << 15) / (m * n * k + 1));
+}
+
+template <typename T>
+struct is_fixed_matrix : std::false_type {};
+
+template <typename T, size_t R, size_t C>
+struct is_fixed_matrix<basic_matrix<T, R, C>>
+    : std::bool_constant<R != dynamic_extent> {};
+
+/// @brief Types of matrices of multiply_batched(): the matrices of dynamic
+/// shape or the matrices of fixed size of matching shapes.
+template <typename A, typename B, typename C>
+concept batch_operands =
+    (is_basic_matrix<A>::value && std::same_as<A, B> && std::same_as<A, C>) ||
+    (is_fixed_matrix<A>::value && is_fixed_matrix<B>::value &&
+     requires(const A &a, const B &b, C &c) { c = a * b; });
+
+}  // namespace detail
+
+/**
+ * @brief Adds the products of `batch` pairs of matrices: C[p] += A[p] * B[p].
+ * The matrix `p` of `a` starts at `a + p * stride_a`, the same for `b` and
+ * `c`. The matrices are stored like in gemm(). @see gemm()
+ *
+ * @param m        Rows of `a` and `c`
+ * @param n        Columns of `b` and `c`
+ * @param k        Columns of `a` and rows of `b`
+ * @param a        First matrices
+ * @param lda      Leading dimension of `a`
+ * @param stride_a Elements between the matrices of `a`
+ * @param b        Last matrices
+ * @param ldb      Leading dimension of `b`
+ * @param stride_b Elements between the matrices of `b`
+ * @param c        Results
+ * @param ldc      Leading dimension of `c`
+ * @param stride_c Elements between the matrices of `c`
+ * @param batch    Number of products
+ */
+template <typename T>
+void gemm_batched(size_t m, size_t n, size_t k, const T *a, size_t lda,
+                  size_t stride_a, const T *b, size_t ldb, size_t stride_b,
+                  T *c, size_t ldc, size_t stride_c, size_t batch) {
+  if (m == 0 || n == 0 || k == 0 || batch == 0) return;
+  BEZ_STATS_OPERATION(multiply, m * n * batch, 2 * m * n * k * batch);
+
+  parallel_for(
+      batch, detail::batch_grain(m, n, k),
+      [&](size_t begin, size_t end) {
+        for (size_t p = begin; p < end; p++)
+          if (m * n * k <= 32 * 32 * 32)
+            detail::gemm_small(m, n, k, a + p * stride_a, lda, b + p * stride_b,
+                               ldb, c + p * stride_c, ldc);
+          else
+            gemm(m, n, k, a + p * stride_a, lda, b + p * stride_b, ldb,
+                 c + p * stride_c, ldc);
+      },
+      std::max<size_t>(1, m * n * k / 64));
+}
+
+/**
+ * @brief Adds the products of `batch` pairs of matrices stored interleaved:
+ * the element (i, j) of the matrix `p` of `rows` x `columns` is
+ * `x[(i * columns + j) * batch + p]`. The same elements of neighboring
+ * matrices are in the same registers, so the small matrices are multiplied
+ * with the full registers. @see matrix_batch
+ *
+ * @param m     Rows of `a` and `c`
+ * @param n     Columns of `b` and `c`
+ * @param k     Columns of `a` and rows of `b`
+ * @param a     First matrices
+ * @param b     Last matrices
+ * @param c     Results
+ * @param batch Number of products
+ */
+template <typename T>
+void gemm_interleaved(size_t m, size_t n, size_t k, const T *a, const T *b,
+                      T *c, size_t batch) {
+  if (m == 0 || n == 0 || k == 0 || batch == 0) return;
+  BEZ_STATS_OPERATION(multiply, m * n * batch, 2 * m * n * k * batch);
+
+  // The lanes of the block of matrices `b` stay in L1 cache
+  const size_t lanes = std::clamp<size_t>(
+      (size_t{32} << 10) / (k * n * sizeof(T)) / 16 * 16, 16, 512);
+
+  parallel_for(
+      batch, lanes,
+      [&](size_t begin, size_t end) {
+        const size_t length = end - begin;
+        simd::detail::dispatch<T>([&](auto ops) {
+          for (size_t i = 0; i < m; i++)
+            for (size_t p = 0; p < k; p++) {
+              const T *lhs = a + (i * k + p) * batch + begin;
+              for (size_t j = 0; j < n; j++)
+                decltype(ops)::fmadd(lhs, b + (p * n + j) * batch + begin,
+                                     c + (i * n + j) * batch + begin, length);
+            }
+        });
+      },
+      m * n * k / 64 + 1);
+}
+
+/**
+ * @class matrix_batch basic_batch.h
+ *
+ * @brief Batch of `count` matrices of the same shape stored interleaved.
+ * @see gemm_interleaved()
+ *
+ * @details The memory is taken from the resource like basic_vector. If the
+ * memory isn't allocated, the batch is empty with the error status
+ * `STATUS::BAD_ALLOCATOR`. The indexes aren't checked.
+ *
+ * @tparam T Integral or float point number
+ */
+template <number T>
+class matrix_batch {
+ private:
+  size_t _Count;             // Number of matrices
+  size_t _Rows;              // Rows of matrices
+  size_t _Columns;           // Columns of matrices
+  basic_vector<T> _Elements;  // Interleaved elements
+  STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Allocates `count` matrices of `rows` x `columns` zeros.
+   *
+   * @param count    Number of matrices
+   * @param rows     Rows of matrices
+   * @param columns  Columns of matrices
+   * @param resource Source of memory
+   */
+  matrix_batch(size_t count, size_t rows, size_t columns,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Count(count),
+        _Rows(rows),
+        _Columns(columns),
+        _Elements(count * rows * columns, resource) {
+    if (_Elements.length() != count * rows * columns) {
+      _Count = _Rows = _Columns = 0;
+      _Status = STATUS::BAD_ALLOCATOR;
+    }
+  }
+
+  /**
+   * @brief Copies the matrices of the same shape into the batch. If the
+   * shapes are different, the batch is empty with the error status
+   * `STATUS::BOUND_ARRAY`.
+   *
+   * @param matrices Matrices
+   * @param resource Source of memory
+   */
+  explicit matrix_batch(
+      std::span<const basic_matrix<T>> matrices,
+      std::pmr::memory_resource *resource = thread_resource())
+      : matrix_batch(matrices.size(),
+                     matrices.empty() ? 0 : matrices[0].rows(),
+                     matrices.empty() ? 0 : matrices[0].columns(), resource) {
+    for (size_t p = 0; p < matrices.size(); p++) {
+      if (matrices[p].rows() != _Rows || matrices[p].columns() != _Columns) {
+        *this = matrix_batch(0, 0, 0, resource);
+        _Status = STATUS::BOUND_ARRAY;
+        return;
+      }
+      for (size_t i = 0; i < _Rows; i++)
+        for (size_t j = 0; j < _Columns; j++) set(p, i, j, matrices[p](i, j));
+    }
+  }
+
+  /// @brief Get the element (row, column) of the matrix `index`.
+  T at(size_t index, size_t row, size_t column) const {
+    return _Elements[(row * _Columns + column) * _Count + index];
+  }
+
+  /// @brief Set the element (row, column) of the matrix `index`.
+  void set(size_t index, size_t row, size_t column, T value) {
+    _Elements.set(value, (row * _Columns + column) * _Count + index);
+  }
+
+  /// @brief Get the copy of the matrix `index`.
+  basic_matrix<T> matrix(size_t index) const {
+    basic_matrix<T> result(_Rows, _Columns, uninitialized);
+    for (size_t i = 0; i < _Rows; i++)
+      for (size_t j = 0; j < _Columns; j++)
+        result.set(i, j, at(index, i, j));
+    return result;
+  }
+
+  T *data() { return _Elements.data(); }
+  const T *data() const { return _Elements.data(); }
+
+  size_t count() const { return _Count; }
+  size_t rows() const { return _Rows; }
+  size_t columns() const { return _Columns; }
+
+  STATUS status() const { return _Status; }
+
+  const std::string to_string_status() const { return to_string(status()); }
+
+  /**
+   * @brief Computes the products of matrices of batches: result[p] = lhs[p] *
+   * rhs[p]. The result takes the shape of products; if it has the same
+   * shape, its memory is reused. It's found by the arguments, so it's called
+   * without `bez::`.
+   *
+   * @param lhs    First matrices
+   * @param rhs    Last matrices
+   * @param result Products
+   * @return `STATUS::BOUND_ARRAY`, if the numbers of matrices are different
+   * or the columns of `lhs` aren't equal to the rows of `rhs`
+   */
+  friend STATUS multiply(const matrix_batch &lhs, const matrix_batch &rhs,
+                         matrix_batch &result) {
+    if (lhs._Count != rhs._Count || lhs._Columns != rhs._Rows)
+      return STATUS::BOUND_ARRAY;
+    if (&result == &lhs || &result == &rhs) {
+      matrix_batch product(lhs._Count, lhs._Rows, rhs._Columns,
+                           result._Elements.resource());
+      const STATUS status = multiply(lhs, rhs, product);
+      if (status == STATUS::GOOD_ALLOCATOR) result = std::move(product);
+      return status;
+    }
+
+    if (result._Count != lhs._Count || result._Rows != lhs._Rows ||
+        result._Columns != rhs._Columns)
+      result = matrix_batch(lhs._Count, lhs._Rows, rhs._Columns,
+                            result._Elements.resource());
+    else
+      std::fill(result.data(), result.data() + result._Elements.length(), 0);
+    if (result._Count != lhs._Count) return STATUS::BAD_ALLOCATOR;
+
+    gemm_interleaved(lhs._Rows, rhs._Columns, lhs._Columns, lhs.data(),
+                     rhs.data(), result.data(), lhs._Count);
+    return STATUS::GOOD_ALLOCATOR;
+  }
+};
+
+/**
+ * @brief Computes the products of arrays of matrices, e.g. `std::vector` or
+ * `std::span`: result[p] = lhs[p] * rhs[p]. The matrices are multiplied in
+ * parallel without the temporary matrices.
+ * @code
+ * std::vector<bez::basic_matrix<double>> a = ..., b = ..., c(a.size());
+ * bez::multiply_batched(a, b, c);
+ * @endcode
+ *
+ * @details The results of basic_matrix of the same shape reuse their memory,
+ * other results are allocated again. The matrices of fixed size are
+ * multiplied by the unrolled products.
+ *
+ * @param lhs    First matrices
+ * @param rhs    Last matrices
+ * @param result Products, of the same number as `lhs`
+ * @return `STATUS::BOUND_ARRAY`, if the numbers of matrices are different or
+ * the shapes of matrices don't match
+ */
+template <std::ranges::contiguous_range L, std::ranges::contiguous_range R,
+          std::ranges::contiguous_range P>
+  requires detail::batch_operands<std::ranges::range_value_t<L>,
+                                  std::ranges::range_value_t<R>,
+                                  std::ranges::range_value_t<P>>
+STATUS multiply_batched(const L &lhs, const R &rhs, P &&result) {
+  using A = std::ranges::range_value_t<L>;
+  const std::span<const A> a(lhs);
+  const std::span<const std::ranges::range_value_t<R>> b(rhs);
+  const std::span<std::ranges::range_value_t<P>> c(result);
+  if (a.size() != b.size() || a.size() != c.size()) return STATUS::BOUND_ARRAY;
+  if (a.empty()) return STATUS::GOOD_ALLOCATOR;
+
+  if constexpr (detail::is_basic_matrix<A>::value) {
+    using T = typename A::value_type;
+    const size_t m = a[0].rows(), k = a[0].columns(), n = b[0].columns();
+    for (size_t p = 0; p < a.size(); p++)
+      if (a[p].rows() != m || a[p].columns() != k || b[p].rows() != k ||
+          b[p].columns() != n)
+        return STATUS::BOUND_ARRAY;
+
+    for (auto &matrix : c) {
+      if (matrix.rows() != m || matrix.columns() != n)
+        matrix = basic_matrix<T>(m, n);
+      else
+        for (size_t i = 0; i < m; i++)
+          std::fill(matrix.data() + i * matrix.stride(),
+                    matrix.data() + i * matrix.stride() + n, T(0));
+      if (matrix.rows() != m) return STATUS::BAD_ALLOCATOR;
+    }
+
+    BEZ_STATS_OPERATION(multiply, m * n * a.size(), 2 * m * n * k * a.size());
+    parallel_for(
+        a.size(), detail::batch_grain(m, n, k),
+        [&](size_t begin, size_t end) {
+          for (size_t p = begin; p < end; p++)
+            detail::gemm_small(m, n, k, a[p].data(), a[p].stride(),
+                               b[p].data(), b[p].stride(), c[p].data(),
+                               c[p].stride());
+        },
+        std::max<size_t>(1, m * n * k / 64));
+  } else {
+    constexpr size_t m = A::rows(), k = A::columns();
+    constexpr size_t n = std::ranges::range_value_t<R>::columns();
+
+    BEZ_STATS_OPERATION(multiply, m * n * a.size(), 2 * m * n * k * a.size());
+    parallel_for(
+        a.size(), detail::batch_grain(m, n, k),
+        [&](size_t begin, size_t end) {
+          for (size_t p = begin; p < end; p++) c[p] = a[p] * b[p];
+        },
+        std::max<size_t>(1, m * n * k / 64));
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,331 @@
+/**
+ * @file basic_blas.h
+ * @brief Implements the BLAS-like operations which accumulate into the
+ * existing vector or matrix without the temporaries: `scal`, `axpy`, `dot`,
+ * `gemv` and `gemm` with the factors `alpha` and `beta`. With `BEZ_CBLAS=1`
+ * the operations of `float` and `double` are computed by the linked CBLAS.
+ * @code
+ * bez::axpy(a, x, y);                // y = a * x + y
+ * bez::gemv(alpha, m, x, beta, y);   // y = alpha * m * x + beta * y
+ * bez::gemm(alpha, a, b, beta, c);   // c = alpha * a * b + beta * c
+ * bez::gemm(1.0, a.transpose(), b, 0.0, c);
+ * @endcode
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_BLAS
+#define BASIC_BLAS
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_vector.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `scal`, `axpy`, `dot`, `gemv`, `gemm` and the
+ *   dispatch to CBLAS.
+ * * 2026-10-14 V0.2 The products of the small integers, which are promoted to
+ *   `int`, are converted back to `T`, so `gemv` of `int16_t` is compiled.
+ */
+
+/**
+ * Calls CBLAS for `float` and `double`. The library must be linked, e.g. by
+ * the option `BEZ_USE_BLAS` of CMake. Other types use the own kernels.
+ */
+#ifndef BEZ_CBLAS
+#define BEZ_CBLAS 0
+#endif
+
+#if BEZ_CBLAS
+#include <cblas.h>
+#endif
+
+namespace bez {
+
+namespace detail {
+
+/// @brief Is the operation of type `T` computed by CBLAS.
+template <typename T>
+inline constexpr bool use_cblas =
+    BEZ_CBLAS && (std::same_as<T, float> || std::same_as<T, double>);
+
+#if BEZ_CBLAS
+/**
+ * @brief Get the layout of the view for CBLAS: the rows or the columns must
+ * be contiguous. Otherwise returns false, and the own kernels are used.
+ *
+ * @param view       Matrix, which is stored in row-major order
+ * @param transposed Is the view stored like the transposed matrix
+ * @param ld         Leading dimension
+ * @return Can CBLAS multiply the view
+ */
+template <typename T>
+bool cblas_layout(const matrix_view<const T> &view, CBLAS_TRANSPOSE &transposed,
+                  int &ld) {
+  if (view.column_stride() == 1 && view.row_stride() >= view.columns()) {
+    transposed = CblasNoTrans;
+    ld = static_cast<int>(std::max<size_t>(1, view.row_stride()));
+    return true;
+  }
+  if (view.row_stride() == 1 && view.column_stride() >= view.rows()) {
+    transposed = CblasTrans;
+    ld = static_cast<int>(std::max<size_t>(1, view.column_stride()));
+    return true;
+  }
+  return false;
+}
+#endif
+
+/// @brief Multiplies `length` elements by `beta`. The elements are zeros, if
+/// `beta` is 0, so NaN of `data` isn't kept.
+template <typename T>
+void scale_by(T *data, size_t length, T beta) {
+  if (beta == 0)
+    std::fill(data, data + length, T(0));
+  else if (beta != 1)
+    simd::mul(data, beta, data, length);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Multiplies the vector by the number in place: x = alpha * x.
+ *
+ * @param alpha Number
+ * @param x     Vector
+ */
+template <typename T>
+void scal(T alpha, basic_vector<T> &x) {
+  if constexpr (detail::use_cblas<T>) {
+    if (x.length() != 0) {
+      BEZ_STATS_OPERATION(scale, x.length(), x.length());
+      if constexpr (std::same_as<T, float>)
+        cblas_sscal(static_cast<int>(x.length()), alpha, x.data(), 1);
+      else
+        cblas_dscal(static_cast<int>(x.length()), alpha, x.data(), 1);
+    }
+  } else {
+    x *= alpha;
+  }
+}
+
+/**
+ * @brief Adds the vector multiplied by the number in place: y = alpha * x + y.
+ * The elements are computed by the fused multiply-add and in parallel. If the
+ * lengths are different, `y` isn't changed.
+ *
+ * @param alpha Number
+ * @param x     Added vector
+ * @param y     Result
+ * @return `STATUS::BOUND_ARRAY` if the lengths are different, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T>
+STATUS axpy(T alpha, const basic_vector<T> &x, basic_vector<T> &y) {
+  if (x.length() != y.length()) return STATUS::BOUND_ARRAY;
+  if (alpha == 0 || x.length() == 0) return STATUS::GOOD_ALLOCATOR;
+  BEZ_STATS_OPERATION(expression, x.length(), 2 * x.length());
+  if constexpr (detail::use_cblas<T>) {
+    if constexpr (std::same_as<T, float>)
+      cblas_saxpy(static_cast<int>(x.length()), alpha, x.data(), 1, y.data(),
+                  1);
+    else
+      cblas_daxpy(static_cast<int>(x.length()), alpha, x.data(), 1, y.data(),
+                  1);
+  } else {
+    parallel_for(x.length(), detail::evaluate_grain,
+                 [&](size_t begin, size_t end) {
+                   simd::axpy(alpha, x.data() + begin, y.data() + begin,
+                              end - begin);
+                 });
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Calculates the scalar product of vectors. If the lengths are
+ * different, it returns 0 with the error status `STATUS::BOUND_ARRAY` of `x`.
+ * @see basic_vector::dot()
+ *
+ * @param x First vector
+ * @param y Last vector
+ * @return Scalar product
+ */
+template <typename T>
+T dot(const basic_vector<T> &x, const basic_vector<T> &y) {
+  if constexpr (detail::use_cblas<T>) {
+    if (x.length() == y.length()) {
+      BEZ_STATS_OPERATION(dot, x.length(), 2 * x.length());
+      if constexpr (std::same_as<T, float>)
+        return cblas_sdot(static_cast<int>(x.length()), x.data(), 1,
+                          y.data(), 1);
+      else
+        return cblas_ddot(static_cast<int>(x.length()), x.data(), 1,
+                          y.data(), 1);
+    }
+  }
+  return x.dot(y);
+}
+
+/**
+ * @brief Computes the product of matrix and vector into the existing vector:
+ * y = alpha * a * x + beta * y. The matrix may be the view, e.g.
+ * `m.transpose()`, it isn't copied. If `beta` is 0, the elements of `y` are
+ * only written. If the shapes don't match, `y` isn't changed.
+ *
+ * @param alpha Factor of the product
+ * @param a     `m` x `n` matrix or view
+ * @param x     Vector of `n` elements
+ * @param beta  Factor of `y`
+ * @param y     Vector of `m` elements
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, the status of the
+ * view if it's bad, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T, detail::strided_matrix A>
+STATUS gemv(T alpha, const A &a, const basic_vector<T> &x, T beta,
+            basic_vector<T> &y) {
+  const matrix_view<const T> view = detail::view_of<T>(a);
+  if (view.status() != STATUS::GOOD_ALLOCATOR) return view.status();
+  const size_t m = view.rows(), n = view.columns();
+  if (n != x.length() || m != y.length()) return STATUS::BOUND_ARRAY;
+  if (m == 0) return STATUS::GOOD_ALLOCATOR;
+  BEZ_STATS_OPERATION(multiply, m, 2 * m * n);
+
+#if BEZ_CBLAS
+  if constexpr (detail::use_cblas<T>) {
+    CBLAS_TRANSPOSE transposed;
+    int ld;
+    if (n != 0 && detail::cblas_layout(view, transposed, ld)) {
+      // The transposed view is the matrix of `n` rows
+      const int rows = static_cast<int>(transposed == CblasNoTrans ? m : n);
+      const int columns = static_cast<int>(transposed == CblasNoTrans ? n : m);
+      if constexpr (std::same_as<T, float>)
+        cblas_sgemv(CblasRowMajor, transposed, rows, columns, alpha,
+                    view.data(), ld, x.data(), 1, beta, y.data(), 1);
+      else
+        cblas_dgemv(CblasRowMajor, transposed, rows, columns, alpha,
+                    view.data(), ld, x.data(), 1, beta, y.data(), 1);
+      return STATUS::GOOD_ALLOCATOR;
+    }
+  }
+#endif
+
+  const T *data = view.data();
+  const size_t rs = view.row_stride(), cs = view.column_stride();
+  if (cs == 1) {
+    // The rows are contiguous, so the elements are the scalar products
+    parallel_for(m, std::max<size_t>(1, detail::evaluate_grain / (n + 1)),
+                 [&](size_t begin, size_t end) {
+                   for (size_t i = begin; i < end; i++) {
+                     T &value = y.data()[i];
+                     value = beta == 0 ? T(0) : beta * value;
+                     if (alpha != 0)
+                       value += alpha * simd::dot(data + i * rs, x.data(), n);
+                   }
+                 },
+                 n + 1);
+  } else if (rs == 1) {
+    // The columns are contiguous, e.g. of the transposed matrix, so the
+    // columns multiplied by the elements of `x` are added to `y`
+    parallel_for(m, detail::evaluate_grain / 4,
+                 [&](size_t begin, size_t end) {
+                   T *line = y.data() + begin;
+                   detail::scale_by(line, end - begin, beta);
+                   if (alpha == 0) return;
+                   for (size_t j = 0; j < n; j++)
+                     simd::axpy(T(alpha * x.data()[j]), data + j * cs + begin,
+                                line, end - begin);
+                 },
+                 n + 1);
+  } else {
+    for (size_t i = 0; i < m; i++) {
+      T total = 0;
+      for (size_t j = 0; j < n; j++)
+        total += data[i * rs + j * cs] * x.data()[j];
+      T &value = y.data()[i];
+      value = T((beta == 0 ? T(0) : T(beta * value)) + T(alpha * total));
+    }
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Computes the product of matrices into the existing matrix:
+ * c = alpha * a * b + beta * c. The matrices may be the views, e.g.
+ * `a.transpose()`, they are multiplied by their strides without copying. If
+ * `beta` is 0, the elements of `c` are only written. If the shapes don't
+ * match, `c` isn't changed. @see gemm_strided()
+ *
+ * @param alpha Factor of the product
+ * @param a     `m` x `k` matrix or view
+ * @param b     `k` x `n` matrix or view
+ * @param beta  Factor of `c`
+ * @param c     `m` x `n` matrix
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, the status of the
+ * view if it's bad, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T, detail::strided_matrix A, detail::strided_matrix B>
+STATUS gemm(T alpha, const A &a, const B &b, T beta, basic_matrix<T> &c) {
+  const matrix_view<const T> lhs = detail::view_of<T>(a);
+  const matrix_view<const T> rhs = detail::view_of<T>(b);
+  if (lhs.status() != STATUS::GOOD_ALLOCATOR) return lhs.status();
+  if (rhs.status() != STATUS::GOOD_ALLOCATOR) return rhs.status();
+  const size_t m = lhs.rows(), n = rhs.columns(), k = lhs.columns();
+  if (k != rhs.rows() || m != c.rows() || n != c.columns())
+    return STATUS::BOUND_ARRAY;
+  if (m == 0 || n == 0) return STATUS::GOOD_ALLOCATOR;
+
+#if BEZ_CBLAS
+  if constexpr (detail::use_cblas<T>) {
+    CBLAS_TRANSPOSE transposed_a, transposed_b;
+    int lda, ldb;
+    if (k != 0 && detail::cblas_layout(lhs, transposed_a, lda) &&
+        detail::cblas_layout(rhs, transposed_b, ldb)) {
+      BEZ_STATS_OPERATION(multiply, m * n, 2 * m * n * k);
+      const int ldc = static_cast<int>(std::max<size_t>(1, c.stride()));
+      if constexpr (std::same_as<T, float>)
+        cblas_sgemm(CblasRowMajor, transposed_a, transposed_b,
+                    static_cast<int>(m), static_cast<int>(n),
+                    static_cast<int>(k), alpha, lhs.data(), lda, rhs.data(),
+                    ldb, beta, c.data(), ldc);
+      else
+        cblas_dgemm(CblasRowMajor, transposed_a, transposed_b,
+                    static_cast<int>(m), static_cast<int>(n),
+                    static_cast<int>(k), alpha, lhs.data(), lda, rhs.data(),
+                    ldb, beta, c.data(), ldc);
+      return STATUS::GOOD_ALLOCATOR;
+    }
+  }
+#endif
+
+  if (beta != 1)
+    parallel_for(m, std::max<size_t>(1, detail::evaluate_grain / (n + 1)),
+                 [&](size_t begin, size_t end) {
+                   for (size_t i = begin; i < end; i++)
+                     detail::scale_by(c.data() + i * c.stride(), n, beta);
+                 },
+                 n);
+  gemm_strided(m, n, k, lhs.data(), lhs.row_stride(), lhs.column_stride(),
+               rhs.data(), rhs.row_stride(), rhs.column_stride(), c.data(),
+               c.stride(), alpha);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,620 @@
+/**
+ * @file basic_device.h
+ * @brief Implements the matrices in the memory of GPU and the operations on
+ * them, which are queued to the stream: the transfers, `*`, `+`, `-`, the
+ * products by numbers and the reductions. With `BEZ_CUDA=1` the matrices of
+ * `float` and `double` are stored on the device and computed by cuBLAS. If
+ * the library is built without CUDA, there is no device, or the type isn't
+ * supported, the matrices stay on the host and the operations are computed
+ * by the kernels of the library at once. So the same code runs everywhere.
+ * @code
+ * bez::device_stream stream;
+ * bez::device_matrix<float> a(n, n, stream), b(n, n, stream);
+ * a.upload(x);
+ * b.upload(y);
+ * bez::device_matrix<float> c = a * b + 2.0f * a;
+ * c.download(z);
+ * stream.synchronize();  // z = x * y + 2 * x
+ * @endcode
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_DEVICE
+#define BASIC_DEVICE
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+#include "basic_blas.h"
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+#include "basic_precision.h"
+#include "basic_simd.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the streams, the matrices of device and the
+ *   operations by CUDA and cuBLAS with the fallback to the host.
+ */
+
+/**
+ * Stores the matrices of `float` and `double` of basic_device.h on GPU. The
+ * CUDA runtime and cuBLAS must be linked, e.g. by the option `BEZ_USE_CUDA`
+ * of CMake. Otherwise the matrices stay on the host.
+ */
+#ifndef BEZ_CUDA
+#define BEZ_CUDA 0
+#endif
+
+#if BEZ_CUDA
+#include <cublas_v2.h>
+#include <cuda_runtime.h>
+#endif
+
+namespace bez {
+
+namespace detail {
+
+/// @brief Is the matrix of type `T` stored on the device, if it's present.
+template <typename T>
+inline constexpr bool use_device =
+    BEZ_CUDA && (std::same_as<T, float> || std::same_as<T, double>);
+
+#if BEZ_CUDA
+/// @brief Status of the call of CUDA: `STATUS::BAD_ALLOCATOR` on any error.
+inline STATUS device_status(cudaError_t error) {
+  return error == cudaSuccess ? STATUS::GOOD_ALLOCATOR : STATUS::BAD_ALLOCATOR;
+}
+
+/// @brief Status of the call of cuBLAS: `STATUS::BAD_ALLOCATOR` on any error.
+inline STATUS device_status(cublasStatus_t error) {
+  return error == CUBLAS_STATUS_SUCCESS ? STATUS::GOOD_ALLOCATOR
+                                        : STATUS::BAD_ALLOCATOR;
+}
+#endif
+
+}  // namespace detail
+
+/// @brief Is there a device, on which the matrices are computed. It's checked
+/// once.
+inline bool device_available() {
+#if BEZ_CUDA
+  static const bool available = [] {
+    int count = 0;
+    return cudaGetDeviceCount(&count) == cudaSuccess && count > 0;
+  }();
+  return available;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @class device_stream basic_device.h
+ *
+ * @brief Queue of the operations of device: the operations of one stream are
+ * executed in order and asynchronously to the host, the operations of
+ * different streams may overlap. Without the device the operations are
+ * executed at once and synchronize() does nothing.
+ *
+ * @details The stream must live longer than its matrices.
+ */
+class device_stream {
+ public:
+  /// @brief Creates the stream and the handle of cuBLAS on the current
+  /// device, if it's present.
+  device_stream() {
+#if BEZ_CUDA
+    if (!device_available() ||
+        cudaStreamCreateWithFlags(&_Stream, cudaStreamNonBlocking) !=
+            cudaSuccess) {
+      _Stream = nullptr;
+      return;
+    }
+    if (cublasCreate(&_Blas) != CUBLAS_STATUS_SUCCESS ||
+        cublasSetStream(_Blas, _Stream) != CUBLAS_STATUS_SUCCESS) {
+      if (_Blas != nullptr) cublasDestroy(_Blas);
+      cudaStreamDestroy(_Stream);
+      _Blas = nullptr;
+      _Stream = nullptr;
+    }
+#endif
+  }
+
+  device_stream(const device_stream &) = delete;
+  device_stream &operator=(const device_stream &) = delete;
+
+  /// @brief Waits for the queued operations and destroys the stream.
+  ~device_stream() {
+#if BEZ_CUDA
+    if (_Stream != nullptr) {
+      cudaStreamSynchronize(_Stream);
+      cublasDestroy(_Blas);
+      cudaStreamDestroy(_Stream);
+    }
+#endif
+  }
+
+  /// @brief Are the operations of stream executed on the device.
+  bool on_device() const noexcept {
+#if BEZ_CUDA
+    return _Stream != nullptr;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * @brief Waits for the queued operations, e.g. downloads.
+   *
+   * @return `STATUS::BAD_ALLOCATOR` if an operation failed, otherwise
+   * `STATUS::GOOD_ALLOCATOR`
+   */
+  STATUS synchronize() {
+#if BEZ_CUDA
+    if (on_device())
+      return detail::device_status(cudaStreamSynchronize(_Stream));
+#endif
+    return STATUS::GOOD_ALLOCATOR;
+  }
+
+#if BEZ_CUDA
+  /// @brief Get the stream of CUDA, or nullptr without the device.
+  cudaStream_t native() const noexcept { return _Stream; }
+
+  /// @brief Get the handle of cuBLAS bound to the stream.
+  cublasHandle_t blas() const noexcept { return _Blas; }
+
+ private:
+  cudaStream_t _Stream{nullptr};
+  cublasHandle_t _Blas{nullptr};
+#endif
+};
+
+/**
+ * @class device_matrix basic_device.h
+ *
+ * @brief Matrix in the memory of device, which belongs to the stream. The
+ * memory is allocated and freed in order of the stream, and the elements are
+ * initialized to zero like basic_matrix. If the stream isn't on the device,
+ * or `T` isn't `float` or `double` with `BEZ_CUDA`, the elements are stored
+ * in basic_matrix on the host.
+ *
+ * @details The operands of one operation must belong to one stream. The
+ * errors are kept in the status like basic_matrix: the shapes which don't
+ * match set `STATUS::BOUND_ARRAY`, the operands of different streams set
+ * `STATUS::BAD_INITIALIZED`, the errors of device set
+ * `STATUS::BAD_ALLOCATOR`.
+ *
+ * @tparam T Integral or float point number
+ */
+template <typename T>
+class device_matrix {
+ public:
+  using value_type = T;
+
+  /**
+   * @brief Initialize matrix `rows` x `columns` of the `stream` to zero.
+   *
+   * @param rows    Rows of matrix
+   * @param columns Columns of matrix
+   * @param stream  Stream, which queues the operations
+   */
+  device_matrix(size_t rows, size_t columns, device_stream &stream)
+      : _Stream(&stream),
+        _Rows(rows),
+        _Columns(columns),
+        _Host(resident(stream) ? 0 : rows, resident(stream) ? 0 : columns) {
+    _Status = _Host.status();
+#if BEZ_CUDA
+    if (!resident(stream) || rows * columns == 0) return;
+    cudaStream_t native = stream.native();
+    void *memory = nullptr;
+    _Status = detail::device_status(
+        cudaMallocAsync(&memory, rows * columns * sizeof(T), native));
+    if (_Status != STATUS::GOOD_ALLOCATOR) return;
+    _Device = static_cast<T *>(memory);
+    _Status = detail::device_status(
+        cudaMemsetAsync(_Device, 0, rows * columns * sizeof(T), native));
+#endif
+  }
+
+  device_matrix(const device_matrix &) = delete;
+  device_matrix &operator=(const device_matrix &) = delete;
+
+  /// @brief Move constructor. The `other` is left empty with the shape 0x0.
+  device_matrix(device_matrix &&other) noexcept
+      : _Stream(other._Stream),
+        _Rows(std::exchange(other._Rows, 0)),
+        _Columns(std::exchange(other._Columns, 0)),
+        _Device(std::exchange(other._Device, nullptr)),
+        _Host(std::move(other._Host)),
+        _Status(other._Status) {}
+
+  /// @brief Move operation `=`. Frees the memory of this matrix.
+  device_matrix &operator=(device_matrix &&other) noexcept {
+    if (this != &other) {
+      release();
+      _Stream = other._Stream;
+      _Rows = std::exchange(other._Rows, 0);
+      _Columns = std::exchange(other._Columns, 0);
+      _Device = std::exchange(other._Device, nullptr);
+      _Host = std::move(other._Host);
+      _Status = other._Status;
+    }
+    return *this;
+  }
+
+  /// @brief Frees the memory in order of the stream.
+  ~device_matrix() { release(); }
+
+  /// @brief Get rows of matrix.
+  size_t rows() const noexcept { return _Rows; }
+
+  /// @brief Get columns of matrix.
+  size_t columns() const noexcept { return _Columns; }
+
+  /// @brief Get the status of the last error.
+  STATUS status() const noexcept { return _Status; }
+
+  /// @brief Get the stream of matrix.
+  device_stream &stream() const noexcept { return *_Stream; }
+
+  /// @brief Are the elements stored on the device.
+  bool on_device() const noexcept { return resident(*_Stream); }
+
+  /// @brief Get the elements: the memory of device, if on_device(),
+  /// otherwise the memory of host.
+  T *data() noexcept { return on_device() ? _Device : _Host.data(); }
+
+  /// @brief Get the elements. @see data()
+  const T *data() const noexcept {
+    return on_device() ? _Device : _Host.data();
+  }
+
+  /// @brief Get the distance between the rows. The rows of device are
+  /// contiguous.
+  size_t stride() const noexcept {
+    return on_device() ? _Columns : _Host.stride();
+  }
+
+  /**
+   * @brief Queues the copy of the `host` matrix to this matrix. The `host`
+   * must live and not change until the stream is synchronized. The copy
+   * overlaps with the host only for the page-locked memory, e.g. registered
+   * by `cudaHostRegister()`.
+   *
+   * @param host Matrix of the same shape
+   * @return `STATUS::BOUND_ARRAY` if the shapes don't match, the status of
+   * `host` if it's bad, `STATUS::GOOD_ALLOCATOR` on success
+   */
+  STATUS upload(const basic_matrix<T> &host) {
+    if (host.status() != STATUS::GOOD_ALLOCATOR) return _Status = host.status();
+    if (host.rows() != _Rows || host.columns() != _Columns)
+      return _Status = STATUS::BOUND_ARRAY;
+#if BEZ_CUDA
+    if (on_device()) {
+      if (_Rows * _Columns == 0) return STATUS::GOOD_ALLOCATOR;
+      return _Status = detail::device_status(cudaMemcpy2DAsync(
+                 _Device, _Columns * sizeof(T), host.data(),
+                 host.stride() * sizeof(T), _Columns * sizeof(T), _Rows,
+                 cudaMemcpyHostToDevice, _Stream->native()));
+    }
+#endif
+    for (size_t i = 0; i < _Rows; i++)
+      std::copy_n(host.data() + i * host.stride(), _Columns,
+                  _Host.data() + i * _Host.stride());
+    return STATUS::GOOD_ALLOCATOR;
+  }
+
+  /**
+   * @brief Queues the copy of this matrix to the `host` matrix. The elements
+   * of `host` are ready after the stream is synchronized. @see upload()
+   *
+   * @param host Matrix of the same shape
+   * @return `STATUS::BOUND_ARRAY` if the shapes don't match, the status of
+   * this matrix if it's bad, `STATUS::GOOD_ALLOCATOR` on success
+   */
+  STATUS download(basic_matrix<T> &host) const {
+    if (_Status != STATUS::GOOD_ALLOCATOR) return _Status;
+    if (host.rows() != _Rows || host.columns() != _Columns)
+      return STATUS::BOUND_ARRAY;
+#if BEZ_CUDA
+    if (on_device()) {
+      if (_Rows * _Columns == 0) return STATUS::GOOD_ALLOCATOR;
+      return detail::device_status(cudaMemcpy2DAsync(
+          host.data(), host.stride() * sizeof(T), _Device,
+          _Columns * sizeof(T), _Columns * sizeof(T), _Rows,
+          cudaMemcpyDeviceToHost, _Stream->native()));
+    }
+#endif
+    for (size_t i = 0; i < _Rows; i++)
+      std::copy_n(_Host.data() + i * _Host.stride(), _Columns,
+                  host.data() + i * host.stride());
+    return STATUS::GOOD_ALLOCATOR;
+  }
+
+  /**
+   * @brief Product of matrices into the new matrix of the stream.
+   * @see gemm(T, const device_matrix<T> &, const device_matrix<T> &, T,
+   * device_matrix<T> &)
+   */
+  friend device_matrix operator*(const device_matrix &lhs,
+                                 const device_matrix &rhs) {
+    device_matrix result(lhs._Rows, rhs._Columns, *lhs._Stream);
+    result.keep(gemm(T(1), lhs, rhs, T(0), result));
+    return result;
+  }
+
+  /// @brief Sum of matrices into the new matrix of the stream. @see geam()
+  friend device_matrix operator+(const device_matrix &lhs,
+                                 const device_matrix &rhs) {
+    device_matrix result(lhs._Rows, lhs._Columns, *lhs._Stream);
+    result.keep(geam(T(1), lhs, T(1), rhs, result));
+    return result;
+  }
+
+  /// @brief Difference of matrices into the new matrix of the stream.
+  /// @see geam()
+  friend device_matrix operator-(const device_matrix &lhs,
+                                 const device_matrix &rhs) {
+    device_matrix result(lhs._Rows, lhs._Columns, *lhs._Stream);
+    result.keep(geam(T(1), lhs, T(-1), rhs, result));
+    return result;
+  }
+
+  /// @brief Product of matrix and number into the new matrix of the stream.
+  friend device_matrix operator*(const device_matrix &lhs, T number) {
+    device_matrix result(lhs._Rows, lhs._Columns, *lhs._Stream);
+    result.keep(geam(number, lhs, T(0), lhs, result));
+    return result;
+  }
+
+  /// @brief Product of number and matrix into the new matrix of the stream.
+  friend device_matrix operator*(T number, const device_matrix &rhs) {
+    return rhs * number;
+  }
+
+ private:
+  device_stream *_Stream;  // Stream, which queues the operations
+  size_t _Rows;            // Rows of matrix
+  size_t _Columns;         // Columns of matrix
+  T *_Device{nullptr};     // Memory of device of `_Rows * _Columns` elements
+  basic_matrix<T> _Host;   // Elements without the device
+  STATUS _Status{STATUS::GOOD_ALLOCATOR};
+
+  /// @brief Are the matrices of the `stream` stored on the device.
+  static bool resident(const device_stream &stream) noexcept {
+    return detail::use_device<T> && stream.on_device();
+  }
+
+  /// @brief Keeps the first error of the operation.
+  void keep(STATUS status) noexcept {
+    if (_Status == STATUS::GOOD_ALLOCATOR) _Status = status;
+  }
+
+  void release() noexcept {
+#if BEZ_CUDA
+    if (_Device != nullptr) cudaFreeAsync(_Device, _Stream->native());
+#endif
+    _Device = nullptr;
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Checks the operands of the operation of device: the statuses, the
+ * stream and the shapes `rows` x `columns` of `result`.
+ *
+ * @return The error status or `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T, typename... M>
+STATUS device_operands(const device_matrix<T> &result, size_t rows,
+                       size_t columns, const M &...operands) {
+  STATUS status = result.status();
+  ((status = status != STATUS::GOOD_ALLOCATOR ? status : operands.status()),
+   ...);
+  if (status != STATUS::GOOD_ALLOCATOR) return status;
+  if (((&operands.stream() != &result.stream()) || ...))
+    return STATUS::BAD_INITIALIZED;
+  if (result.rows() != rows || result.columns() != columns)
+    return STATUS::BOUND_ARRAY;
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Queues the product of the matrices of device into the existing
+ * matrix: c = alpha * a * b + beta * c. If `beta` is 0, the elements of `c`
+ * are only written. The row-major matrices are passed to cuBLAS as the
+ * transposed column-major ones: C^T = B^T * A^T. @see gemm()
+ *
+ * @param alpha Factor of the product
+ * @param a     `m` x `k` matrix
+ * @param b     `k` x `n` matrix
+ * @param beta  Factor of `c`
+ * @param c     `m` x `n` matrix
+ * @return The error status of operands or of the device, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T>
+STATUS gemm(T alpha, const device_matrix<T> &a, const device_matrix<T> &b,
+            T beta, device_matrix<T> &c) {
+  const size_t m = a.rows(), n = b.columns(), k = a.columns();
+  if (STATUS status = detail::device_operands(c, m, n, a, b);
+      status != STATUS::GOOD_ALLOCATOR)
+    return status;
+  if (b.rows() != k) return STATUS::BOUND_ARRAY;
+  if (m == 0 || n == 0) return STATUS::GOOD_ALLOCATOR;
+#if BEZ_CUDA
+  if constexpr (detail::use_device<T>) {
+    if (c.on_device()) {
+      const int rows = static_cast<int>(m), columns = static_cast<int>(n),
+                terms = static_cast<int>(k);
+      if constexpr (std::same_as<T, float>)
+        return detail::device_status(cublasSgemm(
+            c.stream().blas(), CUBLAS_OP_N, CUBLAS_OP_N, columns, rows, terms,
+            &alpha, b.data(), columns, a.data(), std::max(terms, 1), &beta,
+            c.data(), columns));
+      else
+        return detail::device_status(cublasDgemm(
+            c.stream().blas(), CUBLAS_OP_N, CUBLAS_OP_N, columns, rows, terms,
+            &alpha, b.data(), columns, a.data(), std::max(terms, 1), &beta,
+            c.data(), columns));
+    }
+  }
+#endif
+  for (size_t i = 0; i < m; i++)
+    detail::scale_by(c.data() + i * c.stride(), n, beta);
+  gemm_strided(m, n, k, a.data(), a.stride(), size_t{1}, b.data(), b.stride(),
+               size_t{1}, c.data(), c.stride(), alpha);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Queues the sum of the matrices of device multiplied by the numbers
+ * into the existing matrix: c = alpha * a + beta * b. `c` may be `a` or `b`.
+ *
+ * @param alpha Factor of `a`
+ * @param a     `m` x `n` matrix
+ * @param beta  Factor of `b`
+ * @param b     `m` x `n` matrix
+ * @param c     `m` x `n` matrix
+ * @return The error status of operands or of the device, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T>
+STATUS geam(T alpha, const device_matrix<T> &a, T beta,
+            const device_matrix<T> &b, device_matrix<T> &c) {
+  const size_t m = a.rows(), n = a.columns();
+  if (STATUS status = detail::device_operands(c, m, n, a, b);
+      status != STATUS::GOOD_ALLOCATOR)
+    return status;
+  if (m * n == 0) return STATUS::GOOD_ALLOCATOR;
+#if BEZ_CUDA
+  if constexpr (detail::use_device<T>) {
+    if (c.on_device()) {
+      const int rows = static_cast<int>(m), columns = static_cast<int>(n);
+      if constexpr (std::same_as<T, float>)
+        return detail::device_status(cublasSgeam(
+            c.stream().blas(), CUBLAS_OP_N, CUBLAS_OP_N, columns, rows,
+            &alpha, a.data(), columns, &beta, b.data(), columns, c.data(),
+            columns));
+      else
+        return detail::device_status(cublasDgeam(
+            c.stream().blas(), CUBLAS_OP_N, CUBLAS_OP_N, columns, rows,
+            &alpha, a.data(), columns, &beta, b.data(), columns, c.data(),
+            columns));
+    }
+  }
+#endif
+  parallel_for(
+      m, std::max<size_t>(1, detail::evaluate_grain / n),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          const T *lhs = a.data() + i * a.stride(),
+                  *rhs = b.data() + i * b.stride();
+          T *result = c.data() + i * c.stride();
+          for (size_t j = 0; j < n; j++)
+            result[j] = alpha * lhs[j] + beta * rhs[j];
+        }
+      },
+      n);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Computes the scalar product of the matrices of device as of the
+ * vectors of elements. It waits for the queued operations.
+ *
+ * @param a      `m` x `n` matrix
+ * @param b      `m` x `n` matrix
+ * @param result Scalar product
+ * @return The error status of operands or of the device, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T>
+STATUS dot(const device_matrix<T> &a, const device_matrix<T> &b, T &result) {
+  const size_t m = a.rows(), n = a.columns();
+  result = T(0);
+  if (STATUS status = detail::device_operands(a, m, n, b);
+      status != STATUS::GOOD_ALLOCATOR)
+    return status;
+  if (m * n == 0) return STATUS::GOOD_ALLOCATOR;
+#if BEZ_CUDA
+  if constexpr (detail::use_device<T>) {
+    if (a.on_device()) {
+      const int length = static_cast<int>(m * n);
+      if constexpr (std::same_as<T, float>)
+        return detail::device_status(cublasSdot(
+            a.stream().blas(), length, a.data(), 1, b.data(), 1, &result));
+      else
+        return detail::device_status(cublasDdot(
+            a.stream().blas(), length, a.data(), 1, b.data(), 1, &result));
+    }
+  }
+#endif
+  accumulator_t<T> sum = 0;
+  for (size_t i = 0; i < m; i++)
+    sum += simd::dot(a.data() + i * a.stride(), b.data() + i * b.stride(), n);
+  result = static_cast<T>(sum);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Computes the Frobenius norm of the matrix of device. It waits for
+ * the queued operations.
+ *
+ * @param a      Matrix
+ * @param result Square root of the sum of squares of elements
+ * @return The error status of `a` or of the device, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T>
+STATUS norm(const device_matrix<T> &a, real_t<T> &result) {
+  const size_t m = a.rows(), n = a.columns();
+  result = 0;
+  if (a.status() != STATUS::GOOD_ALLOCATOR) return a.status();
+  if (m * n == 0) return STATUS::GOOD_ALLOCATOR;
+#if BEZ_CUDA
+  if constexpr (detail::use_device<T>) {
+    if (a.on_device()) {
+      const int length = static_cast<int>(m * n);
+      T value = 0;
+      STATUS status;
+      if constexpr (std::same_as<T, float>)
+        status = detail::device_status(
+            cublasSnrm2(a.stream().blas(), length, a.data(), 1, &value));
+      else
+        status = detail::device_status(
+            cublasDnrm2(a.stream().blas(), length, a.data(), 1, &value));
+      result = value;
+      return status;
+    }
+  }
+#endif
+  real_t<T> sum = 0;
+  for (size_t i = 0; i < m; i++) {
+    const T *row = a.data() + i * a.stride();
+    sum += static_cast<real_t<T>>(simd::dot(row, row, n));
+  }
+  result = std::sqrt(sum);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,865 @@
+/**
+ * @file basic_expression.h
+ * @brief Implements the expression templates for basic_vector and
+ * basic_matrix. The operations `+`, `-`, `*` and `/` by a number don't compute
+ * the result, but return the lightweight node of expression. The whole
+ * expression is computed with one loop only when it's assigned to a vector or
+ * a matrix.
+ *
+ * @version 0.10
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_EXPRESSION
+#define BASIC_EXPRESSION
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <type_traits>
+
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_transpose.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the expressions of vector and matrix.
+ * * 2026-10-14 V0.2 Simple expressions of two vectors are computed by the
+ *   kernels of basic_simd.h.
+ * * 2026-10-14 V0.3 Large expressions are computed in parallel.
+ * * 2026-10-14 V0.4 The sizes of vector and matrix are the template
+ *   parameters. The vectors and matrices of fixed size aren't the operands.
+ * * 2026-10-14 V0.5 Computing of expressions is counted by the statistics.
+ *   @see basic_stats.h
+ * * 2026-10-14 V0.6 Declared basic_sparse_matrix. @see basic_sparse.h
+ * * 2026-10-14 V0.7 The transposed views are computed by the tiled kernel.
+ *   @see basic_transpose.h
+ * * 2026-10-14 V0.8 `sum()` accumulates in `accumulator_t`.
+ * * 2026-10-14 V0.9 The matrix expressions, which read the destination by
+ *   another layout, e.g. `m = m.transpose()`, are computed into the temporary.
+ * * 2026-10-14 V0.10 Added `aliases()` of the vector expressions.
+ */
+
+namespace bez {
+
+template <number T, size_t N = dynamic_extent>
+class basic_vector;
+
+template <typename T, size_t R = dynamic_extent, size_t C = R>
+class basic_matrix;
+
+template <number T, sparse_format F = sparse_format::csr>
+class basic_sparse_matrix;
+
+/**
+ * @class vector_expression basic_expression.h
+ *
+ * @brief Base of all nodes of vector expression. @see vector_operand
+ *
+ * @details Every node has `value_type`, `length()`, `status()` and two
+ * accessors of element: `element(i)`, which is used when the status of
+ * expression isn't `STATUS::BOUND_ARRAY`, and `guarded(i)`, which reproduces
+ * the eager operations: the sum or the difference of vectors of different
+ * lengths are the vector of zeros.
+ *
+ * @note The nodes keep the pointers to the memory of vectors. Don't keep the
+ * expression in `auto` variable longer than its vectors live.
+ *
+ * @tparam E Type of node
+ */
+template <typename E>
+struct vector_expression {
+  /// @brief Calculates the sum of elements of expression without the temporary
+  /// vector. It's accumulated in `accumulator_t` of the elements.
+  auto sum() const {
+    using wide_type = accumulator_t<typename E::value_type>;
+    const E &self = static_cast<const E &>(*this);
+    wide_type total = 0;
+    if (self.status() == STATUS::BOUND_ARRAY)
+      for (size_t i = 0; i < self.length(); i++)
+        total += static_cast<wide_type>(self.guarded(i));
+    else
+      for (size_t i = 0; i < self.length(); i++)
+        total += static_cast<wide_type>(self.element(i));
+    return total;
+  }
+};
+
+/**
+ * @class matrix_expression basic_expression.h
+ *
+ * @brief Base of all nodes of matrix expression. Nodes are like nodes of
+ * vector expression, but have `rows()`, `columns()` and accessors with two
+ * indexes. The `guarded(row, column)` of the sum or the difference
+ * of matrices of different shapes is the first matrix. @see vector_expression
+ *
+ * @tparam E Type of node
+ */
+template <typename E>
+struct matrix_expression {};
+
+namespace detail {
+
+template <typename E>
+struct is_basic_vector : std::false_type {};
+
+template <number T>
+struct is_basic_vector<basic_vector<T>> : std::true_type {};
+
+template <typename E>
+struct is_basic_matrix : std::false_type {};
+
+template <typename T>
+struct is_basic_matrix<basic_matrix<T>> : std::true_type {};
+
+}  // namespace detail
+
+/// @brief basic_vector or the node of vector expression.
+template <typename E>
+concept vector_operand = detail::is_basic_vector<E>::value ||
+                         std::derived_from<E, vector_expression<E>>;
+
+/// @brief basic_matrix or the node of matrix expression.
+template <typename E>
+concept matrix_operand = detail::is_basic_matrix<E>::value ||
+                         std::derived_from<E, matrix_expression<E>>;
+
+/**
+ * @class vector_reference basic_expression.h
+ *
+ * @brief Leaf of vector expression, which refers to the memory of vector.
+ *
+ * @tparam T Integral or float point number
+ */
+template <typename T>
+class vector_reference : public vector_expression<vector_reference<T>> {
+ private:
+  const T *_Data;  // Elements of vector
+  size_t _Length;  // Length of vector
+
+ public:
+  using value_type = T;
+
+  constexpr vector_reference(const T *data, size_t length)
+      : _Data(data), _Length(length) {}
+
+  constexpr const T *data() const { return _Data; }
+  constexpr size_t length() const { return _Length; }
+  constexpr STATUS status() const { return STATUS::GOOD_ALLOCATOR; }
+  constexpr T element(size_t index) const { return _Data[index]; }
+  constexpr T guarded(size_t index) const { return _Data[index]; }
+};
+
+/**
+ * @class vector_binary basic_expression.h
+ *
+ * @brief Node of element-wise operation `Op` of two vectors.
+ *
+ * @tparam L  Node of first vector
+ * @tparam R  Node of last vector
+ * @tparam Op Operation of two elements
+ */
+template <typename L, typename R, typename Op>
+class vector_binary : public vector_expression<vector_binary<L, R, Op>> {
+ private:
+  L _Lhs;       // First vector
+  R _Rhs;       // Last vector
+  bool _Valid;  // Are the lengths of the vectors the same
+
+ public:
+  using value_type = typename L::value_type;
+
+  constexpr vector_binary(const L &lhs, const R &rhs)
+      : _Lhs(lhs), _Rhs(rhs), _Valid(lhs.length() == rhs.length()) {}
+
+  constexpr const L &lhs() const { return _Lhs; }
+  constexpr const R &rhs() const { return _Rhs; }
+  constexpr size_t length() const { return _Lhs.length(); }
+
+  constexpr STATUS status() const {
+    if (!_Valid) return STATUS::BOUND_ARRAY;
+    if (_Lhs.status() != STATUS::GOOD_ALLOCATOR) return _Lhs.status();
+    return _Rhs.status();
+  }
+
+  constexpr value_type element(size_t index) const {
+    return static_cast<value_type>(
+        Op{}(_Lhs.element(index), _Rhs.element(index)));
+  }
+
+  constexpr value_type guarded(size_t index) const {
+    if (!_Valid) return 0;
+    return static_cast<value_type>(
+        Op{}(_Lhs.guarded(index), _Rhs.guarded(index)));
+  }
+};
+
+/**
+ * @class vector_scalar basic_expression.h
+ *
+ * @brief Node of operation `Op` of each element of vector and the number.
+ *
+ * @tparam E  Node of vector
+ * @tparam Op Operation of element and number
+ */
+template <typename E, typename Op>
+class vector_scalar : public vector_expression<vector_scalar<E, Op>> {
+ public:
+  using value_type = typename E::value_type;
+
+ private:
+  E _Expression;   // Vector
+  value_type _K;   // Number
+  STATUS _Status;  // Status of operation
+
+ public:
+  constexpr vector_scalar(const E &expression, value_type k, STATUS status)
+      : _Expression(expression), _K(k), _Status(status) {}
+
+  constexpr const E &expression() const { return _Expression; }
+  constexpr value_type k() const { return _K; }
+  constexpr size_t length() const { return _Expression.length(); }
+
+  constexpr STATUS status() const {
+    if (_Status != STATUS::GOOD_ALLOCATOR) return _Status;
+    return _Expression.status();
+  }
+
+  constexpr value_type element(size_t index) const {
+    return static_cast<value_type>(Op{}(_Expression.element(index), _K));
+  }
+
+  constexpr value_type guarded(size_t index) const {
+    return static_cast<value_type>(Op{}(_Expression.guarded(index), _K));
+  }
+};
+
+/**
+ * @class matrix_reference basic_expression.h
+ *
+ * @brief Leaf of matrix expression, which refers to the memory of matrix.
+ *
+ * @tparam T Integral or float point number
+ */
+template <typename T>
+class matrix_reference : public matrix_expression<matrix_reference<T>> {
+ private:
+  const T *_Data;   // Elements of matrix
+  size_t _Rows;     // Rows of matrix
+  size_t _Columns;  // Columns of matrix
+  size_t _Stride;   // Leading dimension
+
+ public:
+  using value_type = T;
+
+  constexpr matrix_reference(const T *data, size_t rows, size_t columns,
+                             size_t stride)
+      : _Data(data), _Rows(rows), _Columns(columns), _Stride(stride) {}
+
+  constexpr const T *data() const { return _Data; }
+  constexpr size_t stride() const { return _Stride; }
+  constexpr const T *row(size_t row) const { return _Data + row * _Stride; }
+  constexpr size_t rows() const { return _Rows; }
+  constexpr size_t columns() const { return _Columns; }
+  constexpr STATUS status() const { return STATUS::GOOD_ALLOCATOR; }
+
+  constexpr T element(size_t row, size_t column) const {
+    return _Data[row * _Stride + column];
+  }
+
+  constexpr T guarded(size_t row, size_t column) const {
+    return _Data[row * _Stride + column];
+  }
+};
+
+/**
+ * @class matrix_binary basic_expression.h
+ *
+ * @brief Node of element-wise operation `Op` of two matrices.
+ *
+ * @tparam L  Node of first matrix
+ * @tparam R  Node of last matrix
+ * @tparam Op Operation of two elements
+ */
+template <typename L, typename R, typename Op>
+class matrix_binary : public matrix_expression<matrix_binary<L, R, Op>> {
+ private:
+  L _Lhs;       // First matrix
+  R _Rhs;       // Last matrix
+  bool _Valid;  // Are the shapes of the matrices the same
+
+ public:
+  using value_type = typename L::value_type;
+
+  constexpr matrix_binary(const L &lhs, const R &rhs)
+      : _Lhs(lhs),
+        _Rhs(rhs),
+        _Valid(lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns()) {}
+
+  constexpr const L &lhs() const { return _Lhs; }
+  constexpr const R &rhs() const { return _Rhs; }
+  constexpr size_t rows() const { return _Lhs.rows(); }
+  constexpr size_t columns() const { return _Lhs.columns(); }
+
+  constexpr STATUS status() const {
+    if (!_Valid) return STATUS::BOUND_ARRAY;
+    if (_Lhs.status() != STATUS::GOOD_ALLOCATOR) return _Lhs.status();
+    return _Rhs.status();
+  }
+
+  constexpr value_type element(size_t row, size_t column) const {
+    return static_cast<value_type>(
+        Op{}(_Lhs.element(row, column), _Rhs.element(row, column)));
+  }
+
+  constexpr value_type guarded(size_t row, size_t column) const {
+    if (!_Valid) return _Lhs.guarded(row, column);
+    return static_cast<value_type>(
+        Op{}(_Lhs.guarded(row, column), _Rhs.guarded(row, column)));
+  }
+};
+
+/**
+ * @class matrix_scalar basic_expression.h
+ *
+ * @brief Node of operation `Op` of each element of matrix and the number.
+ *
+ * @tparam E  Node of matrix
+ * @tparam Op Operation of element and number
+ */
+template <typename E, typename Op>
+class matrix_scalar : public matrix_expression<matrix_scalar<E, Op>> {
+ public:
+  using value_type = typename E::value_type;
+
+ private:
+  E _Expression;   // Matrix
+  value_type _K;   // Number
+  STATUS _Status;  // Status of operation
+
+ public:
+  constexpr matrix_scalar(const E &expression, value_type k, STATUS status)
+      : _Expression(expression), _K(k), _Status(status) {}
+
+  constexpr const E &expression() const { return _Expression; }
+  constexpr value_type k() const { return _K; }
+  constexpr size_t rows() const { return _Expression.rows(); }
+  constexpr size_t columns() const { return _Expression.columns(); }
+
+  constexpr STATUS status() const {
+    if (_Status != STATUS::GOOD_ALLOCATOR) return _Status;
+    return _Expression.status();
+  }
+
+  constexpr value_type element(size_t row, size_t column) const {
+    return static_cast<value_type>(Op{}(_Expression.element(row, column), _K));
+  }
+
+  constexpr value_type guarded(size_t row, size_t column) const {
+    return static_cast<value_type>(Op{}(_Expression.guarded(row, column), _K));
+  }
+};
+
+namespace detail {
+
+/// @brief Get the node of vector expression for vector or node.
+template <vector_operand E>
+constexpr auto as_node(const E &operand) {
+  if constexpr (is_basic_vector<E>::value)
+    return vector_reference<typename E::value_type>(operand.data(),
+                                                    operand.length());
+  else
+    return operand;
+}
+
+/// @brief Get the node of matrix expression for matrix or node.
+template <matrix_operand E>
+constexpr auto as_matrix_node(const E &operand) {
+  if constexpr (is_basic_matrix<E>::value)
+    return matrix_reference<typename E::value_type>(
+        operand.data(), operand.rows(), operand.columns(), operand.stride());
+  else
+    return operand;
+}
+
+template <typename E>
+using node_t = decltype(as_node(std::declval<const E &>()));
+
+template <typename E>
+using matrix_node_t = decltype(as_matrix_node(std::declval<const E &>()));
+
+/// @brief Arithmetic operations of one element of the node of expression.
+template <typename E>
+inline constexpr size_t flops_of = 0;
+
+template <typename L, typename R, typename Op>
+inline constexpr size_t flops_of<vector_binary<L, R, Op>> =
+    flops_of<L> + flops_of<R> + 1;
+
+template <typename E, typename Op>
+inline constexpr size_t flops_of<vector_scalar<E, Op>> = flops_of<E> + 1;
+
+template <typename L, typename R, typename Op>
+inline constexpr size_t flops_of<matrix_binary<L, R, Op>> =
+    flops_of<L> + flops_of<R> + 1;
+
+template <typename E, typename Op>
+inline constexpr size_t flops_of<matrix_scalar<E, Op>> = flops_of<E> + 1;
+
+// Operations of destination and value for `evaluate()`
+struct assign_op {
+  template <typename D, typename V>
+  constexpr void operator()(D &dst, V value) const {
+    dst = value;
+  }
+};
+
+struct plus_assign_op {
+  template <typename D, typename V>
+  constexpr void operator()(D &dst, V value) const {
+    dst += value;
+  }
+};
+
+struct minus_assign_op {
+  template <typename D, typename V>
+  constexpr void operator()(D &dst, V value) const {
+    dst -= value;
+  }
+};
+
+inline constexpr assign_op assign{};
+inline constexpr plus_assign_op plus_assign{};
+inline constexpr minus_assign_op minus_assign{};
+
+/**
+ * @brief Computes `dst = a + b`, `dst = a - b`, `dst = a * k` and `dst = a / k`
+ * of vectors for the elements [begin, end) by the kernels of basic_simd.h.
+ * @see evaluate()
+ *
+ * @return Is the expression computed
+ */
+template <typename T, typename E>
+bool evaluate_simd(T *dst, const E &expression, size_t begin, size_t end) {
+  using reference = vector_reference<T>;
+  if constexpr (std::is_same_v<E,
+                               vector_binary<reference, reference, std::plus<>>>)
+    simd::add(expression.lhs().data() + begin,
+              expression.rhs().data() + begin, dst + begin, end - begin);
+  else if constexpr (std::is_same_v<E, vector_binary<reference, reference,
+                                                     std::minus<>>>)
+    simd::sub(expression.lhs().data() + begin,
+              expression.rhs().data() + begin, dst + begin, end - begin);
+  else if constexpr (std::is_same_v<E, vector_scalar<reference,
+                                                     std::multiplies<>>>)
+    simd::mul(expression.expression().data() + begin, expression.k(),
+              dst + begin, end - begin);
+  else if constexpr (std::is_same_v<E, vector_scalar<reference,
+                                                     std::divides<>>>)
+    simd::div(expression.expression().data() + begin, expression.k(),
+              dst + begin, end - begin);
+  else
+    return false;
+  return true;
+}
+
+/// @brief Elements of the range of parallel computation of expression.
+inline constexpr size_t evaluate_grain = size_t{1} << 14;
+
+/**
+ * @brief Computes the vector expression into `dst` with one loop. The
+ * operation `op(dst[i], value)` defines assignment or accumulation. The long
+ * vectors are computed in parallel. @see parallel_for()
+ *
+ * @param dst Elements of destination, `expression.length()` of them
+ * @param expression Node of expression
+ * @param op Operation of the element of destination and the value
+ */
+template <typename T, typename E, typename Op>
+void evaluate(T *dst, const E &expression, Op op) {
+  BEZ_STATS_OPERATION(expression, expression.length(),
+                      expression.length() *
+                          (flops_of<E> + !std::is_same_v<Op, assign_op>));
+  const bool guarded = expression.status() == STATUS::BOUND_ARRAY;
+  parallel_for(expression.length(), evaluate_grain,
+               [&](size_t begin, size_t end) {
+                 if constexpr (std::is_same_v<Op, assign_op>)
+                   if (!guarded && evaluate_simd(dst, expression, begin, end))
+                     return;
+
+                 if (guarded)
+                   for (size_t i = begin; i < end; i++)
+                     op(dst[i], expression.guarded(i));
+                 else
+                   for (size_t i = begin; i < end; i++)
+                     op(dst[i], expression.element(i));
+               });
+}
+
+/**
+ * @brief Computes the simple expressions of two matrices for the rows [begin,
+ * end) by the kernels of basic_simd.h row by row. @see evaluate_simd()
+ *
+ * @return Is the expression computed
+ */
+template <typename T, typename E>
+bool evaluate_simd(T *dst, size_t stride, const E &expression, size_t begin,
+                   size_t end) {
+  using reference = matrix_reference<T>;
+  const size_t columns = expression.columns();
+  if constexpr (std::is_same_v<E,
+                               matrix_binary<reference, reference, std::plus<>>>)
+    for (size_t row = begin; row < end; row++)
+      simd::add(expression.lhs().row(row), expression.rhs().row(row),
+                dst + row * stride, columns);
+  else if constexpr (std::is_same_v<E, matrix_binary<reference, reference,
+                                                     std::minus<>>>)
+    for (size_t row = begin; row < end; row++)
+      simd::sub(expression.lhs().row(row), expression.rhs().row(row),
+                dst + row * stride, columns);
+  else if constexpr (std::is_same_v<E, matrix_scalar<reference,
+                                                     std::divides<>>>)
+    for (size_t row = begin; row < end; row++)
+      simd::div(expression.expression().row(row), expression.k(),
+                dst + row * stride, columns);
+  else
+    return false;
+  return true;
+}
+
+/**
+ * @brief Do the blocks of `rows` x `columns` elements `data[i * rs + j * cs]`
+ * and `dst[i * drs + j * dcs]` share the memory. The ranges from the first
+ * to the last element are compared.
+ */
+template <typename T>
+bool overlaps(const T *data, size_t rs, size_t cs, const T *dst, size_t drs,
+              size_t dcs, size_t rows, size_t columns) {
+  if (rows == 0 || columns == 0) return false;
+  const T *last = data + (rows - 1) * rs + (columns - 1) * cs;
+  const T *dst_last = dst + (rows - 1) * drs + (columns - 1) * dcs;
+  return !std::less<>{}(last, dst) && !std::less<>{}(dst_last, data);
+}
+
+/**
+ * @brief Does the matrix expression read the memory of the destination
+ * `dst[row * row_stride + column * column_stride]` by another layout, e.g.
+ * `m = m.transpose()` or `m += m.block(1, 0, n, n)`. Then the element of
+ * destination may be written before it's read for another element. The
+ * leaves of the same layout, e.g. `m = m + m`, read only their own element.
+ */
+template <typename T, typename E>
+bool aliases(const E &node, const T *dst, size_t row_stride,
+             size_t column_stride) {
+  if constexpr (requires {
+                  node.lhs();
+                  node.rhs();
+                })
+    return aliases(node.lhs(), dst, row_stride, column_stride) ||
+           aliases(node.rhs(), dst, row_stride, column_stride);
+  else if constexpr (requires { node.expression(); })
+    return aliases(node.expression(), dst, row_stride, column_stride);
+  else if constexpr (requires {
+                       node.data();
+                       node.row_stride();
+                       node.column_stride();
+                     })
+    return (node.data() != dst || node.row_stride() != row_stride ||
+            node.column_stride() != column_stride) &&
+           overlaps<T>(node.data(), node.row_stride(), node.column_stride(),
+                       dst, row_stride, column_stride, node.rows(),
+                       node.columns());
+  else if constexpr (requires {
+                       node.data();
+                       node.stride();
+                     })
+    return (node.data() != dst || node.stride() != row_stride ||
+            column_stride != 1) &&
+           overlaps<T>(node.data(), node.stride(), 1, dst, row_stride,
+                       column_stride, node.rows(), node.columns());
+  else
+    return false;
+}
+
+/**
+ * @brief Does the vector expression read the memory of the destination
+ * `dst[i * stride]` by another layout, e.g. `v.slice(1, n) = v.slice(0, n)`.
+ * @see aliases() of matrices
+ */
+template <typename T, typename E>
+bool aliases(const E &node, const T *dst, size_t stride) {
+  if constexpr (requires {
+                  node.lhs();
+                  node.rhs();
+                })
+    return aliases(node.lhs(), dst, stride) || aliases(node.rhs(), dst, stride);
+  else if constexpr (requires { node.expression(); })
+    return aliases(node.expression(), dst, stride);
+  else if constexpr (requires {
+                       node.data();
+                       node.stride();
+                       node.length();
+                     })
+    return (node.data() != dst || node.stride() != stride) &&
+           overlaps<T>(node.data(), 0, node.stride(), dst, 0, stride, 1,
+                       node.length());
+  else if constexpr (requires {
+                       node.data();
+                       node.length();
+                     })
+    return (node.data() != dst || stride != 1) &&
+           overlaps<T>(node.data(), 0, 1, dst, 0, stride, 1, node.length());
+  else
+    return false;
+}
+
+/**
+ * @brief Computes the vector expression, which aliases the destination, into
+ * the temporary of `thread_resource()` and calls `store(node)` with the node
+ * of the temporary. @see aliases()
+ *
+ * @return `false` if the temporary isn't allocated
+ */
+template <typename T, typename E, typename F>
+bool evaluate_temporary_vector(const E &expression, F store) {
+  const size_t length = expression.length();
+  std::pmr::memory_resource *resource = thread_resource();
+  T *copy = allocate_elements<T>(resource, length);
+  if (copy == nullptr && length != 0) return false;
+  evaluate(copy, expression, assign_op{});
+  store(vector_reference<T>(copy, length));
+  deallocate_elements(resource, copy, length);
+  return true;
+}
+
+/**
+ * @brief Computes the matrix expression, which aliases the destination, into
+ * the temporary of `thread_resource()` and calls `store(node)` with the node
+ * of the temporary. @see aliases()
+ *
+ * @return `false` if the temporary isn't allocated
+ */
+template <typename T, typename E, typename F>
+bool evaluate_temporary(const E &expression, F store) {
+  const size_t rows = expression.rows(), columns = expression.columns();
+  std::pmr::memory_resource *resource = thread_resource();
+  T *copy = allocate_elements<T>(resource, rows * columns);
+  if (copy == nullptr && rows * columns != 0) return false;
+  evaluate(copy, columns, expression, assign_op{});
+  store(matrix_reference<T>(copy, rows, columns, columns));
+  deallocate_elements(resource, copy, rows * columns);
+  return true;
+}
+
+/**
+ * @brief Computes the matrix expression into `dst` with leading dimension
+ * `stride`. The large matrices are computed in parallel by rows. The
+ * expression, which aliases `dst`, is computed into the temporary, but the
+ * square matrix assigned its own transposed view is transposed in place.
+ * @see evaluate()
+ *
+ * @return `false` if the temporary of aliased expression isn't allocated
+ */
+template <typename T, typename E, typename Op>
+bool evaluate(T *dst, size_t stride, const E &expression, Op op) {
+  if constexpr (std::is_same_v<Op, assign_op> && requires {
+                  expression.data();
+                  expression.row_stride();
+                  expression.column_stride();
+                })
+    if (expression.data() == dst && expression.row_stride() == 1 &&
+        expression.column_stride() == stride &&
+        expression.rows() == expression.columns()) {
+      BEZ_STATS_OPERATION(expression, expression.rows() * expression.columns(),
+                          0);
+      transpose_square(dst, stride, expression.rows());
+      return true;
+    }
+  if (aliases(expression, dst, stride, 1))
+    return evaluate_temporary<T>(expression, [&](const auto &node) {
+      evaluate(dst, stride, node, op);
+    });
+
+  BEZ_STATS_OPERATION(expression, expression.rows() * expression.columns(),
+                      expression.rows() * expression.columns() *
+                          (flops_of<E> + !std::is_same_v<Op, assign_op>));
+  const size_t columns = expression.columns();
+  const bool guarded = expression.status() == STATUS::BOUND_ARRAY;
+
+  // The columns of the transposed view are contiguous, so it's copied by the
+  // tiles instead of the strided reading of rows
+  if constexpr (std::is_same_v<Op, assign_op> && requires {
+                  expression.data();
+                  expression.row_stride();
+                  expression.column_stride();
+                })
+    if (!guarded && expression.row_stride() == 1 &&
+        expression.column_stride() != 1) {
+      transpose_parallel(expression.data(), expression.column_stride(), dst,
+                         stride, columns, expression.rows());
+      return true;
+    }
+
+  const size_t grain = std::max<size_t>(1, evaluate_grain / (columns + 1));
+  parallel_for(
+      expression.rows(), grain,
+      [&](size_t begin, size_t end) {
+        if constexpr (std::is_same_v<Op, assign_op>)
+          if (!guarded && evaluate_simd(dst, stride, expression, begin, end))
+            return;
+
+        for (size_t row = begin; row < end; row++) {
+          T *line = dst + row * stride;
+          if (guarded)
+            for (size_t col = 0; col < columns; col++)
+              op(line[col], expression.guarded(row, col));
+          else
+            for (size_t col = 0; col < columns; col++)
+              op(line[col], expression.element(row, col));
+        }
+      },
+      columns);
+  return true;
+}
+
+template <typename L, typename R>
+concept same_value = std::same_as<typename node_t<L>::value_type,
+                                  typename node_t<R>::value_type>;
+
+template <typename L, typename R>
+concept same_matrix_value =
+    std::same_as<typename matrix_node_t<L>::value_type,
+                 typename matrix_node_t<R>::value_type>;
+
+}  // namespace detail
+
+/**
+ * @brief Calculate the sum of vectors. If the vectors are of different
+ * lengths, the result is vector of zeros with the error status
+ * `STATUS::BOUND_ARRAY`.
+ *
+ * @param lhs First vector
+ * @param rhs Last vector
+ * @return Node of sum of vectors
+ */
+template <vector_operand L, vector_operand R>
+  requires detail::same_value<L, R>
+constexpr auto operator+(const L &lhs, const R &rhs) {
+  using LN = detail::node_t<L>;
+  using RN = detail::node_t<R>;
+  return vector_binary<LN, RN, std::plus<>>(detail::as_node(lhs),
+                                            detail::as_node(rhs));
+}
+
+/**
+ * @brief Return the different of vectors. If the lengths are different, the
+ * result is vector of zeros with the error status `STATUS::BOUND_ARRAY`.
+ *
+ * @param lhs First vector
+ * @param rhs Last vector
+ * @return Node of difference of vectors
+ */
+template <vector_operand L, vector_operand R>
+  requires detail::same_value<L, R>
+constexpr auto operator-(const L &lhs, const R &rhs) {
+  using LN = detail::node_t<L>;
+  using RN = detail::node_t<R>;
+  return vector_binary<LN, RN, std::minus<>>(detail::as_node(lhs),
+                                             detail::as_node(rhs));
+}
+
+/**
+ * @brief Increase each element by a `k` value.
+ *
+ * @param other Vector
+ * @param k Coefficient to increase
+ * @return Node of vector with magnified elements
+ */
+template <vector_operand E>
+constexpr auto operator*(const E &other,
+                         const typename detail::node_t<E>::value_type k) {
+  using N = detail::node_t<E>;
+  return vector_scalar<N, std::multiplies<>>(detail::as_node(other), k,
+                                             STATUS::GOOD_ALLOCATOR);
+}
+
+/**
+ * @brief Decrease each element by a `k` value.
+ *
+ * @details If k = 0, then elements aren't changed and the result has
+ * `STATUS::DIVIDED_ZERO`.
+ *
+ * @param other Vector
+ * @param k Coefficient to decrease
+ * @return Node of vector with decreased elements
+ */
+template <vector_operand E>
+constexpr auto operator/(const E &other,
+                         const typename detail::node_t<E>::value_type k) {
+  using N = detail::node_t<E>;
+  if (k == 0)
+    return vector_scalar<N, std::divides<>>(detail::as_node(other), 1,
+                                            STATUS::DIVIDED_ZERO);
+  return vector_scalar<N, std::divides<>>(detail::as_node(other), k,
+                                          STATUS::GOOD_ALLOCATOR);
+}
+
+/**
+ * @brief Calculate the sum of matrices. If the shapes are different, the
+ * result is the first matrix with the error status `STATUS::BOUND_ARRAY`.
+ *
+ * @param lhs First matrix
+ * @param rhs Last matrix
+ * @return Node of sum of matrices
+ */
+template <matrix_operand L, matrix_operand R>
+  requires detail::same_matrix_value<L, R>
+constexpr auto operator+(const L &lhs, const R &rhs) {
+  using LN = detail::matrix_node_t<L>;
+  using RN = detail::matrix_node_t<R>;
+  return matrix_binary<LN, RN, std::plus<>>(detail::as_matrix_node(lhs),
+                                            detail::as_matrix_node(rhs));
+}
+
+/// @brief Implementation is similar to operation `+` of matrices.
+template <matrix_operand L, matrix_operand R>
+  requires detail::same_matrix_value<L, R>
+constexpr auto operator-(const L &lhs, const R &rhs) {
+  using LN = detail::matrix_node_t<L>;
+  using RN = detail::matrix_node_t<R>;
+  return matrix_binary<LN, RN, std::minus<>>(detail::as_matrix_node(lhs),
+                                             detail::as_matrix_node(rhs));
+}
+
+/**
+ * @brief Decrease each element of matrix by a `k` value. If k = 0, then
+ * elements aren't changed and the result has `STATUS::DIVIDED_ZERO`.
+ *
+ * @param other Matrix
+ * @param k Coefficient to decrease
+ * @return Node of matrix with decreased elements
+ */
+template <matrix_operand E>
+constexpr auto operator/(const E &other,
+                         const typename detail::matrix_node_t<E>::value_type k) {
+  using N = detail::matrix_node_t<E>;
+  if (k == 0)
+    return matrix_scalar<N, std::divides<>>(detail::as_matrix_node(other), 1,
+                                            STATUS::DIVIDED_ZERO);
+  return matrix_scalar<N, std::divides<>>(detail::as_matrix_node(other), k,
+                                          STATUS::GOOD_ALLOCATOR);
+}
+
+}  // namespace bez
+#endif
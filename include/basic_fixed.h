@@ -0,0 +1,571 @@
+/**
+ * @file basic_fixed.h
+ * @brief Implements basic_vector<T, N> and basic_matrix<T, R, C>, whose sizes
+ * are known at compile time. The elements are stored inside the object, so
+ * they don't allocate the memory, and the loops of operations are unrolled.
+ *
+ * @version 0.3
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_FIXED
+#define BASIC_FIXED
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+
+#include "basic_matrix.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the vector and the matrix of fixed size.
+ * * 2026-10-14 V0.2 `==` compares the elements in the same order. Added
+ *   `multiset_equal()`.
+ * * 2026-10-14 V0.3 Added `begin()` and `end()` of vector.
+ */
+
+#if defined(__GNUC__)
+#define BEZ_FIXED_INLINE inline __attribute__((always_inline))
+#else
+#define BEZ_FIXED_INLINE inline
+#endif
+
+namespace bez {
+
+namespace detail {
+
+template <typename F, size_t... I>
+BEZ_FIXED_INLINE constexpr void unroll(F &function, std::index_sequence<I...>) {
+  (function(I), ...);
+}
+
+/// @brief Calls `function(i)` for each i in [0, N) without the loop.
+template <size_t N, typename F>
+BEZ_FIXED_INLINE constexpr void unroll(F &&function) {
+  unroll(function, std::make_index_sequence<N>{});
+}
+
+}  // namespace detail
+
+/**
+ * @class basic_vector basic_fixed.h
+ *
+ * @brief Vector of `N` elements stored inside the object. All operations are
+ * constexpr and unrolled, so small vectors stay in the registers.
+ *
+ * @ingroup Static array
+ *
+ * @details The operations are the same as of basic_vector<T>. The lengths are
+ * checked at compile time, so the vector has no status and no counter
+ * `ngen`. The indexing isn't checked. Division by zero leaves the vector
+ * unchanged like basic_vector<T>, but isn't reported.
+ *
+ * @tparam T Integral or float point number
+ * @tparam N Length of vector
+ */
+template <number T, size_t N>
+class basic_vector {
+  static_assert(N > 0, "Length of fixed vector must be positive");
+
+ private:
+  T _Elements[N]{};  // Elements of vector
+
+ public:
+  using value_type = T;
+
+  /// @brief Initializes the elements to zero.
+  constexpr basic_vector() = default;
+
+  /**
+   * @brief Initializes all elements to `value`.
+   *
+   * @param value Value to initialize
+   */
+  constexpr explicit basic_vector(T value) requires(N > 1) {
+    detail::unroll<N>([&](size_t i) { _Elements[i] = value; });
+  }
+
+  /**
+   * @brief Initializes the elements to `values`.
+   *
+   * @param values `N` values of elements
+   */
+  template <typename... Args>
+    requires(sizeof...(Args) == N && (std::convertible_to<Args, T> && ...))
+  constexpr basic_vector(Args... values)
+      : _Elements{static_cast<T>(values)...} {}
+
+  /// @brief Copies the elements to the vector of dynamic memory.
+  explicit operator basic_vector<T>() const {
+    basic_vector<T> vector(N, uninitialized);
+    std::copy(_Elements, _Elements + N, vector.data());
+    return vector;
+  }
+
+  constexpr T &operator[](const size_t index) { return _Elements[index]; }
+
+  constexpr const T &operator[](const size_t index) const {
+    return _Elements[index];
+  }
+
+  /**
+   * @brief Set the value in Vector[index].
+   *
+   * @param value Value of element
+   * @param index Index of element
+   */
+  constexpr void set(const T value, const size_t index = 0) {
+    _Elements[index] = value;
+  }
+
+  constexpr const T &at(const size_t index) const { return _Elements[index]; }
+
+  constexpr T &at(const size_t index) { return _Elements[index]; }
+
+  constexpr T *data() { return _Elements; }
+
+  constexpr const T *data() const { return _Elements; }
+
+  constexpr T *begin() { return _Elements; }
+  constexpr T *end() { return _Elements + N; }
+  constexpr const T *begin() const { return _Elements; }
+  constexpr const T *end() const { return _Elements + N; }
+
+  static constexpr size_t length() { return N; }
+
+  /// @brief Calculates the sum of elements of vector.
+  constexpr T sum() const {
+    T total = 0;
+    detail::unroll<N>([&](size_t i) { total += _Elements[i]; });
+    return total;
+  }
+
+  /// @brief Calculates the scalar product of vectors.
+  constexpr T dot(const basic_vector &other) const {
+    T total = 0;
+    detail::unroll<N>(
+        [&](size_t i) { total += _Elements[i] * other._Elements[i]; });
+    return total;
+  }
+
+  /// @brief Calculates the vector product of vectors of 3 elements.
+  constexpr basic_vector cross(const basic_vector &other) const
+    requires(N == 3)
+  {
+    const T *a = _Elements, *b = other._Elements;
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+  }
+
+  /// @brief Calculates the minimum of elements.
+  constexpr T min() const {
+    T result = _Elements[0];
+    detail::unroll<N>(
+        [&](size_t i) { result = std::min(result, _Elements[i]); });
+    return result;
+  }
+
+  /// @brief Calculates the maximum of elements.
+  constexpr T max() const {
+    T result = _Elements[0];
+    detail::unroll<N>(
+        [&](size_t i) { result = std::max(result, _Elements[i]); });
+    return result;
+  }
+
+  /// @brief Calculates the Euclidean norm. @see basic_vector<T>::norm()
+  auto norm() const {
+    using result_type = std::conditional_t<std::floating_point<T>, T, double>;
+    return static_cast<result_type>(
+        std::sqrt(static_cast<result_type>(dot(*this))));
+  }
+
+  constexpr basic_vector &operator+=(const basic_vector &other) {
+    detail::unroll<N>([&](size_t i) { _Elements[i] += other._Elements[i]; });
+    return *this;
+  }
+
+  constexpr basic_vector &operator-=(const basic_vector &other) {
+    detail::unroll<N>([&](size_t i) { _Elements[i] -= other._Elements[i]; });
+    return *this;
+  }
+
+  constexpr basic_vector &operator*=(const T k) {
+    detail::unroll<N>([&](size_t i) { _Elements[i] *= k; });
+    return *this;
+  }
+
+  /// @brief Overload `/=`. If k = 0, returns this.
+  constexpr basic_vector &operator/=(const T k) {
+    if (k == 0) return *this;
+    detail::unroll<N>([&](size_t i) { _Elements[i] /= k; });
+    return *this;
+  }
+
+  friend constexpr basic_vector operator+(basic_vector lhs,
+                                          const basic_vector &rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr basic_vector operator-(basic_vector lhs,
+                                          const basic_vector &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr basic_vector operator-(basic_vector vector) {
+    detail::unroll<N>([&](size_t i) { vector._Elements[i] = -vector[i]; });
+    return vector;
+  }
+
+  friend constexpr basic_vector operator*(basic_vector lhs, const T k) {
+    return lhs *= k;
+  }
+
+  friend constexpr basic_vector operator/(basic_vector lhs, const T k) {
+    return lhs /= k;
+  }
+
+  /// @brief Compares the elements in the same order. @see basic_vector<T>
+  friend constexpr bool operator==(const basic_vector &lhs,
+                                   const basic_vector &rhs) {
+    bool equal = true;
+    detail::unroll<N>([&](size_t i) {
+      equal = equal && lhs._Elements[i] == rhs._Elements[i];
+    });
+    return equal;
+  }
+
+  /**
+   * @brief Checks that the vectors have the same elements in any order. The
+   * short copies are sorted instead of hashing. @see multiset_equal()
+   */
+  friend constexpr bool multiset_equal(basic_vector lhs, basic_vector rhs) {
+    std::sort(lhs._Elements, lhs._Elements + N);
+    std::sort(rhs._Elements, rhs._Elements + N);
+    return lhs == rhs;
+  }
+
+  friend constexpr bool operator!=(const basic_vector &lhs,
+                                   const basic_vector &rhs) {
+    return !(lhs == rhs);
+  }
+
+  /// @brief Compares the sums of elements. @see basic_vector<T>
+  friend constexpr bool operator<(const basic_vector &lhs,
+                                  const basic_vector &rhs) {
+    return lhs.sum() < rhs.sum();
+  }
+
+  friend constexpr bool operator>(const basic_vector &lhs,
+                                  const basic_vector &rhs) {
+    return rhs < lhs;
+  }
+
+  friend constexpr bool operator<=(const basic_vector &lhs,
+                                   const basic_vector &rhs) {
+    return !(lhs > rhs);
+  }
+
+  friend constexpr bool operator>=(const basic_vector &lhs,
+                                   const basic_vector &rhs) {
+    return !(lhs < rhs);
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const basic_vector &obj) {
+    for (size_t i = 0; i < N; i++) os << obj[i] << ' ';
+    return os;
+  }
+
+  friend std::istream &operator>>(std::istream &is, basic_vector &obj) {
+    for (size_t i = 0; i < N; i++) is >> obj[i];
+    return is;
+  }
+};
+
+/**
+ * @class basic_matrix basic_fixed.h
+ *
+ * @brief Matrix of `R` x `C` elements stored inside the object in row-major
+ * order. All operations are constexpr and unrolled, so the matrix 4x4 stays in
+ * the registers.
+ *
+ * @ingroup Static array
+ *
+ * @details The operations are the same as of basic_matrix<T>. The shapes are
+ * checked at compile time, so the matrix has no status. @see basic_vector
+ *
+ * @tparam T Integral or float point number
+ * @tparam R Rows of matrix
+ * @tparam C Columns of matrix
+ */
+template <typename T, size_t R, size_t C>
+class basic_matrix {
+  static_assert(number<T>, "Element of matrix must be a number");
+  static_assert(R != dynamic_extent && C != dynamic_extent,
+                "Both sizes of matrix must be static or dynamic");
+  static_assert(R > 0 && C > 0, "Sizes of fixed matrix must be positive");
+
+ private:
+  T _Elements[R * C]{};  // Elements of matrix in row-major order
+
+ public:
+  using value_type = T;
+
+  /// @brief Initializes the elements to zero.
+  constexpr basic_matrix() = default;
+
+  /**
+   * @brief Initializes all elements to `value`.
+   *
+   * @param value Value to initialize
+   */
+  constexpr explicit basic_matrix(T value) requires(R * C > 1) {
+    detail::unroll<R * C>([&](size_t i) { _Elements[i] = value; });
+  }
+
+  /**
+   * @brief Initializes the elements to `values` in row-major order.
+   *
+   * @param values `R * C` values of elements
+   */
+  template <typename... Args>
+    requires(sizeof...(Args) == R * C &&
+             (std::convertible_to<Args, T> && ...))
+  constexpr basic_matrix(Args... values)
+      : _Elements{static_cast<T>(values)...} {}
+
+  /// @brief Get the identity matrix.
+  static constexpr basic_matrix identity()
+    requires(R == C)
+  {
+    basic_matrix matrix;
+    detail::unroll<R>([&](size_t i) { matrix._Elements[i * C + i] = 1; });
+    return matrix;
+  }
+
+  /// @brief Copies the elements to the matrix of dynamic memory.
+  explicit operator basic_matrix<T>() const {
+    basic_matrix<T> matrix(R, C, uninitialized);
+    for (size_t row = 0; row < R; row++)
+      std::copy(_Elements + row * C, _Elements + (row + 1) * C,
+                matrix.data() + row * matrix.stride());
+    return matrix;
+  }
+
+  /**
+   * @brief Set the value in Matrix[row][column].
+   *
+   * @param row     Index of row
+   * @param column  Index of column
+   * @param value   Value to initialize
+   */
+  constexpr void set(const size_t row, const size_t column, const T value = 0) {
+    _Elements[row * C + column] = value;
+  }
+
+  constexpr const T &at(const size_t row, const size_t column) const {
+    return _Elements[row * C + column];
+  }
+
+  constexpr T &at(const size_t row, const size_t column) {
+    return _Elements[row * C + column];
+  }
+
+  constexpr T &operator()(const size_t row, const size_t column) {
+    return _Elements[row * C + column];
+  }
+
+  constexpr const T &operator()(const size_t row, const size_t column) const {
+    return _Elements[row * C + column];
+  }
+
+  static constexpr size_t rows() { return R; }
+
+  static constexpr size_t columns() { return C; }
+
+  static constexpr size_t stride() { return C; }
+
+  constexpr T *data() { return _Elements; }
+
+  constexpr const T *data() const { return _Elements; }
+
+  /// @brief Get the copy of row.
+  constexpr basic_vector<T, C> row(const size_t row) const {
+    basic_vector<T, C> vector;
+    detail::unroll<C>([&](size_t j) { vector[j] = _Elements[row * C + j]; });
+    return vector;
+  }
+
+  /// @brief Get the copy of column.
+  constexpr basic_vector<T, R> column(const size_t column) const {
+    basic_vector<T, R> vector;
+    detail::unroll<R>([&](size_t i) { vector[i] = _Elements[i * C + column]; });
+    return vector;
+  }
+
+  /// @brief Get the transposed matrix.
+  constexpr basic_matrix<T, C, R> transpose() const {
+    basic_matrix<T, C, R> matrix;
+    detail::unroll<R>([&](size_t i) {
+      detail::unroll<C>([&](size_t j) { matrix(j, i) = _Elements[i * C + j]; });
+    });
+    return matrix;
+  }
+
+  /// @brief Calculates the sum of all elements of the matrix.
+  constexpr T sum() const {
+    T total = 0;
+    detail::unroll<R * C>([&](size_t i) { total += _Elements[i]; });
+    return total;
+  }
+
+  constexpr basic_matrix &operator+=(const basic_matrix &other) {
+    detail::unroll<R * C>(
+        [&](size_t i) { _Elements[i] += other._Elements[i]; });
+    return *this;
+  }
+
+  constexpr basic_matrix &operator-=(const basic_matrix &other) {
+    detail::unroll<R * C>(
+        [&](size_t i) { _Elements[i] -= other._Elements[i]; });
+    return *this;
+  }
+
+  constexpr basic_matrix &operator*=(const T k) {
+    detail::unroll<R * C>([&](size_t i) { _Elements[i] *= k; });
+    return *this;
+  }
+
+  /// @brief Overload `/=`. If k = 0, returns this.
+  constexpr basic_matrix &operator/=(const T k) {
+    if (k == 0) return *this;
+    detail::unroll<R * C>([&](size_t i) { _Elements[i] /= k; });
+    return *this;
+  }
+
+  /// @brief Overload `*=` by the square matrix.
+  constexpr basic_matrix &operator*=(const basic_matrix<T, C, C> &other) {
+    return *this = *this * other;
+  }
+
+  friend constexpr basic_matrix operator+(basic_matrix lhs,
+                                          const basic_matrix &rhs) {
+    return lhs += rhs;
+  }
+
+  friend constexpr basic_matrix operator-(basic_matrix lhs,
+                                          const basic_matrix &rhs) {
+    return lhs -= rhs;
+  }
+
+  friend constexpr basic_matrix operator-(basic_matrix matrix) {
+    detail::unroll<R * C>(
+        [&](size_t i) { matrix._Elements[i] = -matrix._Elements[i]; });
+    return matrix;
+  }
+
+  friend constexpr basic_matrix operator*(basic_matrix lhs, const T k) {
+    return lhs *= k;
+  }
+
+  friend constexpr basic_matrix operator/(basic_matrix lhs, const T k) {
+    return lhs /= k;
+  }
+
+  /**
+   * @brief Return the product of matrices. Each row of the result is the sum
+   * of the rows of `rhs` multiplied by the elements of the row of `lhs`.
+   *
+   * @param lhs First matrix R x C
+   * @param rhs Last matrix C x K
+   * @return Product R x K
+   */
+  template <size_t K>
+  friend constexpr basic_matrix<T, R, K> operator*(
+      const basic_matrix &lhs, const basic_matrix<T, C, K> &rhs) {
+    basic_matrix<T, R, K> matrix;
+    T *result = matrix.data();
+    const T *other = rhs.data();
+    detail::unroll<R>([&](size_t i) {
+      detail::unroll<C>([&](size_t p) {
+        const T value = lhs._Elements[i * C + p];
+        detail::unroll<K>(
+            [&](size_t j) { result[i * K + j] += value * other[p * K + j]; });
+      });
+    });
+    return matrix;
+  }
+
+  /// @brief Return the product of matrix and column vector.
+  friend constexpr basic_vector<T, R> operator*(const basic_matrix &lhs,
+                                                const basic_vector<T, C> &rhs) {
+    basic_vector<T, R> vector;
+    detail::unroll<R>([&](size_t i) {
+      T total = 0;
+      detail::unroll<C>(
+          [&](size_t j) { total += lhs._Elements[i * C + j] * rhs[j]; });
+      vector[i] = total;
+    });
+    return vector;
+  }
+
+  /// @brief Compares the elements in the same order. @see basic_matrix<T>
+  friend constexpr bool operator==(const basic_matrix &lhs,
+                                   const basic_matrix &rhs) {
+    bool equal = true;
+    detail::unroll<R * C>([&](size_t i) {
+      equal = equal && lhs._Elements[i] == rhs._Elements[i];
+    });
+    return equal;
+  }
+
+  friend constexpr bool operator!=(const basic_matrix &lhs,
+                                   const basic_matrix &rhs) {
+    return !(lhs == rhs);
+  }
+
+  /// @brief Compares the sums of elements. @see basic_matrix<T>
+  friend constexpr bool operator<(const basic_matrix &lhs,
+                                  const basic_matrix &rhs) {
+    return lhs.sum() < rhs.sum();
+  }
+
+  friend constexpr bool operator>(const basic_matrix &lhs,
+                                  const basic_matrix &rhs) {
+    return rhs < lhs;
+  }
+
+  friend constexpr bool operator<=(const basic_matrix &lhs,
+                                   const basic_matrix &rhs) {
+    return !(lhs > rhs);
+  }
+
+  friend constexpr bool operator>=(const basic_matrix &lhs,
+                                   const basic_matrix &rhs) {
+    return !(lhs < rhs);
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const basic_matrix &obj) {
+    for (size_t row = 0; row < R; row++) {
+      for (size_t col = 0; col < C; col++) os << obj(row, col) << ' ';
+      os << std::endl;
+    }
+    return os;
+  }
+};
+
+}  // namespace bez
+
+#undef BEZ_FIXED_INLINE
+#endif
@@ -0,0 +1,523 @@
+/**
+ * @file basic_gemm.h
+ * @brief Implements the kernel of matrix multiplication for basic_matrix. The
+ * matrices are split into the blocks which fit in the caches, the blocks are
+ * packed into the contiguous panels and multiplied by the register-tiled
+ * micro-kernel.
+ *
+ * @version 0.8
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_GEMM
+#define BASIC_GEMM
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "basic_precision.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+
+#if defined(BEZ_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the blocked multiplication with the packed
+ *   panels.
+ * * 2026-10-14 V0.2 The blocks are multiplied in parallel.
+ * * 2026-10-14 V0.3 Products and buffers are counted by the statistics.
+ *   @see basic_stats.h
+ * * 2026-10-14 V0.4 Added `gemm_strided()` for the matrices of any strides,
+ *   e.g. the transposed views.
+ * * 2026-10-14 V0.5 `gemm_strided()` scales the product by `alpha`.
+ * * 2026-10-14 V0.6 The products of reduced precision are accumulated in
+ *   `accumulator_t`. @see basic_precision.h
+ * * 2026-10-14 V0.7 The micro-kernels of FMA of AVX2 and AVX-512 for float
+ *   and double are selected at run time.
+ * * 2026-10-14 V0.8 The products of `bool` by `alpha` are the conjunctions.
+ */
+
+namespace bez {
+
+/**
+ * @struct gemm_traits basic_gemm.h
+ *
+ * @brief Sizes of blocks of multiplication for the type `T`.
+ *
+ * @details The micro-kernel computes the `MR` x `NR` block of the result in
+ * the registers. The `KC` x `NR` panel of the last matrix stays in L1 cache,
+ * the `MC` x `KC` block of the first matrix stays in L2 cache and the `KC` x
+ * `NC` block of the last matrix stays in L3 cache. Sizes are chosen for 256-bit
+ * vector registers.
+ *
+ * @tparam T Integral or float point number
+ */
+template <typename T>
+struct gemm_traits {
+  static constexpr size_t MR = 4;
+  static constexpr size_t NR = 32 / sizeof(T);
+  static constexpr size_t KC = 256;
+  static constexpr size_t MC = 128;
+  static constexpr size_t NC = 2048;
+};
+
+/// @brief 6x16 micro-kernel keeps 12 registers of accumulators.
+template <>
+struct gemm_traits<float> {
+  static constexpr size_t MR = 6;
+  static constexpr size_t NR = 16;
+  static constexpr size_t KC = 256;
+  static constexpr size_t MC = 144;
+  static constexpr size_t NC = 4096;
+};
+
+/// @brief 6x8 micro-kernel keeps 12 registers of accumulators.
+template <>
+struct gemm_traits<double> {
+  static constexpr size_t MR = 6;
+  static constexpr size_t NR = 8;
+  static constexpr size_t KC = 256;
+  static constexpr size_t MC = 96;
+  static constexpr size_t NC = 2048;
+};
+
+namespace detail {
+
+/// @brief Frees the memory allocated with alignment of cache line.
+struct aligned_delete {
+  template <typename T>
+  void operator()(T *pointer) const {
+    ::operator delete[](pointer, std::align_val_t{64});
+  }
+};
+
+template <typename T>
+using aligned_buffer = std::unique_ptr<T[], aligned_delete>;
+
+/// @brief Allocates not initialized memory of `count` elements with
+/// alignment of cache line.
+template <typename T>
+aligned_buffer<T> allocate_aligned(size_t count) {
+  BEZ_STATS_ALLOCATION(count * sizeof(T));
+  return aligned_buffer<T>(static_cast<T *>(
+      ::operator new[](count * sizeof(T), std::align_val_t{64})));
+}
+
+/// @brief Get the memory of at least `count` elements of the current thread.
+template <typename T>
+T *thread_buffer(size_t count) {
+  thread_local aligned_buffer<T> buffer;
+  thread_local size_t capacity = 0;
+  if (capacity < count) {
+    buffer = allocate_aligned<T>(count);
+    capacity = count;
+  }
+  return buffer.get();
+}
+
+/// @brief Get `alpha * value`, which is the conjunction for `bool`.
+template <typename T>
+constexpr T scaled(T alpha, T value) {
+  if constexpr (std::is_same_v<T, bool>)
+    return alpha && value;
+  else
+    return alpha * value;
+}
+
+/**
+ * @brief Packs `mc` x `kc` block of the first matrix into the panels of `MR`
+ * rows. The element (i, p) of block is `a[i * rs + p * cs]`, of panel is
+ * `packed[p * MR + i]`. The last panel is padded with zeros. The elements of
+ * `S` are widened to `T`.
+ */
+template <typename T, size_t MR, typename S>
+void pack_lhs(size_t mc, size_t kc, const S *a, size_t rs, size_t cs,
+              T *packed) {
+  for (size_t i = 0; i < mc; i += MR) {
+    const size_t rows = std::min(MR, mc - i);
+    for (size_t p = 0; p < kc; p++) {
+      for (size_t r = 0; r < rows; r++)
+        packed[r] = static_cast<T>(a[(i + r) * rs + p * cs]);
+      for (size_t r = rows; r < MR; r++) packed[r] = 0;
+      packed += MR;
+    }
+  }
+}
+
+/**
+ * @brief Packs `kc` x `nc` block of the last matrix into the panels of `NR`
+ * columns. The element (p, j) of block is `b[p * rs + j * cs]`, of panel is
+ * `packed[p * NR + j]` multiplied by `alpha`. The last panel is padded with
+ * zeros. The elements of `S` are widened to `T`.
+ */
+template <typename T, size_t NR, typename S>
+void pack_rhs(size_t kc, size_t nc, const S *b, size_t rs, size_t cs,
+              T *packed, T alpha) {
+  for (size_t j = 0; j < nc; j += NR) {
+    const size_t columns = std::min(NR, nc - j);
+    for (size_t p = 0; p < kc; p++) {
+      const S *line = b + p * rs + j * cs;
+      if (alpha != 1)
+        for (size_t c = 0; c < columns; c++)
+          packed[c] = scaled(alpha, static_cast<T>(line[c * cs]));
+      else if (cs == 1)
+        for (size_t c = 0; c < columns; c++)
+          packed[c] = static_cast<T>(line[c]);
+      else
+        for (size_t c = 0; c < columns; c++)
+          packed[c] = static_cast<T>(line[c * cs]);
+      for (size_t c = columns; c < NR; c++) packed[c] = 0;
+      packed += NR;
+    }
+  }
+}
+
+/**
+ * @brief Computes the `MR` x `NR` block of product of packed panels in the
+ * local accumulators and adds `mr` x `nr` part of it to `c`. It's the
+ * portable kernel of all types. @see micro_kernel()
+ */
+template <typename T, size_t MR, size_t NR>
+inline void micro_kernel_generic(size_t kc, const T *a, const T *b, T *c,
+                                 size_t ldc, size_t mr, size_t nr) {
+  T acc[MR][NR] = {};
+
+  for (size_t p = 0; p < kc; p++) {
+    for (size_t i = 0; i < MR; i++) {
+      const T value = a[i];
+      for (size_t j = 0; j < NR; j++) acc[i][j] += value * b[j];
+    }
+    a += MR;
+    b += NR;
+  }
+
+  if (mr == MR && nr == NR) {
+    for (size_t i = 0; i < MR; i++)
+      for (size_t j = 0; j < NR; j++) c[i * ldc + j] += acc[i][j];
+  } else {
+    for (size_t i = 0; i < mr; i++)
+      for (size_t j = 0; j < nr; j++) c[i * ldc + j] += acc[i][j];
+  }
+}
+
+#if defined(BEZ_SIMD_X86)
+/**
+ * @brief Defines the micro-kernel of `REGISTER`, e.g. `__m256`, for the
+ * elements of `T`: the row of `NR` elements of panel `b` is kept in `NR / W`
+ * registers, and each element of panel `a` is broadcast and multiplied by
+ * FMA. `CHAINS` sets of accumulators take the following terms in turn, so
+ * the latency of FMA is hidden when the tile has few registers. The loops
+ * are unrolled, so the accumulators stay in the registers. The functions
+ * are compiled with the attribute `target` and are only called when
+ * `simd::active()` selects them.
+ */
+#define BEZ_GEMM_DEFINE_KERNEL(NAME, T, REGISTER, CHAINS, SET1, LOAD, STORE,   \
+                               FMADD, ADD, ATTRIBUTES)                         \
+  template <size_t MR, size_t NR>                                              \
+  ATTRIBUTES void NAME(size_t kc, const T *a, const T *b, T *c, size_t ldc,    \
+                       size_t mr, size_t nr) {                                 \
+    constexpr size_t W = sizeof(REGISTER) / sizeof(T), V = NR / W;             \
+    static_assert(NR % W == 0, "The row of panel is whole registers");         \
+    REGISTER acc[CHAINS][MR][V];                                               \
+    _Pragma("GCC unroll 64") for (size_t s = 0; s < CHAINS * MR * V; s++)      \
+        acc[s / (MR * V)][s / V % MR][s % V] = SET1(T(0));                     \
+                                                                               \
+    size_t p = 0;                                                              \
+    for (; p + CHAINS <= kc; p += CHAINS) {                                    \
+      _Pragma("GCC unroll 4") for (size_t h = 0; h < CHAINS; h++) {            \
+        REGISTER row[V];                                                       \
+        _Pragma("GCC unroll 8") for (size_t v = 0; v < V; v++)                 \
+            row[v] = LOAD(b + v * W);                                          \
+        _Pragma("GCC unroll 16") for (size_t i = 0; i < MR; i++) {             \
+          const REGISTER value = SET1(a[i]);                                   \
+          _Pragma("GCC unroll 8") for (size_t v = 0; v < V; v++)               \
+              acc[h][i][v] = FMADD(value, row[v], acc[h][i][v]);               \
+        }                                                                      \
+        a += MR;                                                               \
+        b += NR;                                                               \
+      }                                                                        \
+    }                                                                          \
+    for (; p < kc; p++) {                                                      \
+      _Pragma("GCC unroll 16") for (size_t i = 0; i < MR; i++) {               \
+        const REGISTER value = SET1(a[i]);                                     \
+        _Pragma("GCC unroll 8") for (size_t v = 0; v < V; v++)                 \
+            acc[0][i][v] = FMADD(value, LOAD(b + v * W), acc[0][i][v]);        \
+      }                                                                        \
+      a += MR;                                                                 \
+      b += NR;                                                                 \
+    }                                                                          \
+    _Pragma("GCC unroll 4") for (size_t h = 1; h < CHAINS; h++)                \
+        _Pragma("GCC unroll 64") for (size_t s = 0; s < MR * V; s++)           \
+            acc[0][s / V][s % V] = ADD(acc[0][s / V][s % V],                   \
+                                       acc[h][s / V][s % V]);                  \
+                                                                               \
+    if (mr == MR && nr == NR) {                                                \
+      _Pragma("GCC unroll 64") for (size_t s = 0; s < MR * V; s++) {           \
+        T *line = c + s / V * ldc + s % V * W;                                 \
+        STORE(line, ADD(LOAD(line), acc[0][s / V][s % V]));                    \
+      }                                                                        \
+    } else {                                                                   \
+      alignas(64) T tile[MR][NR];                                              \
+      for (size_t s = 0; s < MR * V; s++)                                      \
+        STORE(&tile[s / V][s % V * W], acc[0][s / V][s % V]);                  \
+      for (size_t i = 0; i < mr; i++)                                          \
+        for (size_t j = 0; j < nr; j++) c[i * ldc + j] += tile[i][j];          \
+    }                                                                          \
+  }
+
+// The tiles of gemm_traits take 12 registers of AVX2 of 16, and 6 registers
+// of AVX-512 of 32, so AVX-512 uses 2 chains
+BEZ_GEMM_DEFINE_KERNEL(micro_kernel_avx2, float, __m256, 1, _mm256_set1_ps,
+                       _mm256_loadu_ps, _mm256_storeu_ps, _mm256_fmadd_ps,
+                       _mm256_add_ps, __attribute__((target("avx2,fma"))))
+BEZ_GEMM_DEFINE_KERNEL(micro_kernel_avx2, double, __m256d, 1, _mm256_set1_pd,
+                       _mm256_loadu_pd, _mm256_storeu_pd, _mm256_fmadd_pd,
+                       _mm256_add_pd, __attribute__((target("avx2,fma"))))
+BEZ_GEMM_DEFINE_KERNEL(micro_kernel_avx512, float, __m512, 2, _mm512_set1_ps,
+                       _mm512_loadu_ps, _mm512_storeu_ps, _mm512_fmadd_ps,
+                       _mm512_add_ps, __attribute__((target("avx512f"))))
+BEZ_GEMM_DEFINE_KERNEL(micro_kernel_avx512, double, __m512d, 2,
+                       _mm512_set1_pd, _mm512_loadu_pd, _mm512_storeu_pd,
+                       _mm512_fmadd_pd, _mm512_add_pd,
+                       __attribute__((target("avx512f"))))
+#undef BEZ_GEMM_DEFINE_KERNEL
+#endif
+
+/**
+ * @brief Computes the `MR` x `NR` block of product of packed panels and adds
+ * `mr` x `nr` part of it to `c`. The blocks of float and double are computed
+ * by the kernels of FMA of the active instruction set, other types and the
+ * processors without AVX2 use micro_kernel_generic().
+ */
+template <typename T, size_t MR, size_t NR>
+inline void micro_kernel(size_t kc, const T *a, const T *b, T *c, size_t ldc,
+                         size_t mr, size_t nr) {
+#if defined(BEZ_SIMD_X86)
+  if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+    switch (simd::active()) {
+      case simd::isa::avx512:
+        if constexpr (NR * sizeof(T) % 64 == 0) {
+          micro_kernel_avx512<MR, NR>(kc, a, b, c, ldc, mr, nr);
+          return;
+        }
+        [[fallthrough]];
+      case simd::isa::avx2:
+        if constexpr (NR * sizeof(T) % 32 == 0) {
+          micro_kernel_avx2<MR, NR>(kc, a, b, c, ldc, mr, nr);
+          return;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+#endif
+  micro_kernel_generic<T, MR, NR>(kc, a, b, c, ldc, mr, nr);
+}
+
+/// @brief Multiplication of small matrices without packing. The elements of
+/// `S` are widened to `T`.
+template <typename T, typename S>
+void gemm_small(size_t m, size_t n, size_t k, const S *a, size_t lda,
+                const S *b, size_t ldb, T *c, size_t ldc) {
+  for (size_t i = 0; i < m; i++) {
+    T *line = c + i * ldc;
+    for (size_t p = 0; p < k; p++) {
+      const T value = static_cast<T>(a[i * lda + p]);
+      const S *other = b + p * ldb;
+      for (size_t j = 0; j < n; j++)
+        line[j] += value * static_cast<T>(other[j]);
+    }
+  }
+}
+
+/**
+ * @brief Multiplication of small matrices of any strides without packing.
+ * The element (i, p) of `a` is `a[i * rsa + p * csa]`, the same for `b`.
+ * The product is multiplied by `alpha`.
+ */
+template <typename T, typename S>
+void gemm_small(size_t m, size_t n, size_t k, const S *a, size_t rsa,
+                size_t csa, const S *b, size_t rsb, size_t csb, T *c,
+                size_t ldc, T alpha) {
+  if (csa == 1 && csb == 1 && alpha == 1) {
+    gemm_small(m, n, k, a, rsa, b, rsb, c, ldc);
+  } else if (csb == 1) {
+    for (size_t i = 0; i < m; i++) {
+      T *line = c + i * ldc;
+      for (size_t p = 0; p < k; p++) {
+        const T value = scaled(alpha, static_cast<T>(a[i * rsa + p * csa]));
+        const S *other = b + p * rsb;
+        for (size_t j = 0; j < n; j++)
+          line[j] += value * static_cast<T>(other[j]);
+      }
+    }
+  } else {
+    // The columns of `b` are the rows, e.g. of A * B^T, so the elements are
+    // the scalar products
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) {
+        T total = 0;
+        for (size_t p = 0; p < k; p++)
+          total += static_cast<T>(a[i * rsa + p * csa]) *
+                   static_cast<T>(b[p * rsb + j * csb]);
+        c[i * ldc + j] += alpha * total;
+      }
+  }
+}
+
+/**
+ * @brief Blocked multiplication of gemm_strided(): C += alpha * A * B. The
+ * elements of `S` are widened to `T` while the blocks are packed.
+ */
+template <typename T, typename S>
+void gemm_blocked(size_t m, size_t n, size_t k, const S *a, size_t rsa,
+                  size_t csa, const S *b, size_t rsb, size_t csb, T *c,
+                  size_t ldc, T alpha) {
+  using traits = gemm_traits<T>;
+  constexpr size_t MR = traits::MR, NR = traits::NR;
+
+  // Packing doesn't pay off when the whole problem fits in L1 cache
+  if (m * n * k <= 32 * 32 * 32) {
+    gemm_small(m, n, k, a, rsa, csa, b, rsb, csb, c, ldc, alpha);
+    return;
+  }
+
+  const size_t kc_max = std::min(traits::KC, k);
+  const size_t mc_max = std::min(traits::MC, (m + MR - 1) / MR * MR);
+  const size_t nc_max = std::min(traits::NC, (n + NR - 1) / NR * NR);
+  auto packed_b = allocate_aligned<T>(kc_max * nc_max);
+
+  // The blocks of `a` and the groups of panels of `b` are shared among the
+  // threads. Several groups are used, when there are few blocks of rows.
+  const size_t blocks = (m + traits::MC - 1) / traits::MC;
+  const size_t threads =
+      m * n * k / 64 < parallel_threshold() ? 1 : num_threads();
+
+  for (size_t jc = 0; jc < n; jc += traits::NC) {
+    const size_t nc = std::min(traits::NC, n - jc);
+    const size_t panels = (nc + NR - 1) / NR;
+    const size_t wanted =
+        std::min(panels, (4 * threads + blocks - 1) / blocks);
+    const size_t group = (panels + wanted - 1) / wanted;  // Panels of group
+    const size_t groups = (panels + group - 1) / group;
+
+    for (size_t pc = 0; pc < k; pc += traits::KC) {
+      const size_t kc = std::min(traits::KC, k - pc);
+
+      parallel_for(
+          panels, 1,
+          [&](size_t begin, size_t end) {
+            pack_rhs<T, NR>(kc, std::min(nc, end * NR) - begin * NR,
+                            b + pc * rsb + (jc + begin * NR) * csb, rsb, csb,
+                            packed_b.get() + begin * NR * kc, alpha);
+          },
+          kc * NR);
+
+      parallel_for(
+          blocks * groups, 1,
+          [&](size_t begin, size_t end) {
+            T *packed_a = thread_buffer<T>(mc_max * kc_max);
+            for (size_t task = begin; task < end; task++) {
+              const size_t ic = task / groups * traits::MC;
+              const size_t mc = std::min(traits::MC, m - ic);
+              const size_t jr_begin = task % groups * group * NR;
+              const size_t jr_end = std::min(nc, jr_begin + group * NR);
+              pack_lhs<T, MR>(mc, kc, a + ic * rsa + pc * csa, rsa, csa,
+                              packed_a);
+
+              for (size_t jr = jr_begin; jr < jr_end; jr += NR) {
+                const size_t nr = std::min(NR, nc - jr);
+                for (size_t ir = 0; ir < mc; ir += MR) {
+                  const size_t mr = std::min(MR, mc - ir);
+                  micro_kernel<T, MR, NR>(
+                      kc, packed_a + ir * kc, packed_b.get() + jr * kc,
+                      c + (ic + ir) * ldc + jc + jr, ldc, mr, nr);
+                }
+              }
+            }
+          },
+          traits::MC * kc * group * NR / 64);
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Adds the product of `m` x `k` matrix `a` and `k` x `n` matrix `b` to
+ * `m` x `n` matrix `c` like gemm(), but the operands have any strides: the
+ * element (i, p) of `a` is `a[i * rsa + p * csa]` and the element (p, j) of
+ * `b` is `b[p * rsb + j * csb]`. The blocks are packed by the strides, so the
+ * transposed operands aren't copied: A^T is `a, 1, lda`. The product is
+ * multiplied by `alpha` while `b` is packed: C += alpha * A * B.
+ * @see gemm()
+ *
+ * @details The product of numbers of reduced precision, e.g. float16 or
+ * int16_t, is accumulated in `accumulator_t<T>` and `c` is rounded once.
+ * The blocks of `a` and `b` are widened while they are packed, so they stay
+ * narrow in memory.
+ *
+ * @param rsa   Distance between the rows of `a`
+ * @param csa   Distance between the columns of `a`
+ * @param rsb   Distance between the rows of `b`
+ * @param csb   Distance between the columns of `b`
+ * @param alpha Factor of the product
+ */
+template <typename T>
+void gemm_strided(size_t m, size_t n, size_t k, const T *a, size_t rsa,
+                  size_t csa, const T *b, size_t rsb, size_t csb, T *c,
+                  size_t ldc, T alpha = T(1)) {
+  using A = accumulator_t<T>;
+  if (m == 0 || n == 0 || k == 0 || alpha == 0) return;
+  BEZ_STATS_OPERATION(multiply, m * n, 2 * m * n * k);
+
+  if constexpr (std::is_same_v<A, T>) {
+    detail::gemm_blocked(m, n, k, a, rsa, csa, b, rsb, csb, c, ldc, alpha);
+  } else {
+    auto wide = detail::allocate_aligned<A>(m * n);
+    for (size_t i = 0; i < m; i++)
+      simd::widen(c + i * ldc, wide.get() + i * n, n);
+    detail::gemm_blocked(m, n, k, a, rsa, csa, b, rsb, csb, wide.get(), n,
+                         static_cast<A>(alpha));
+    for (size_t i = 0; i < m; i++)
+      simd::narrow(wide.get() + i * n, c + i * ldc, n);
+  }
+}
+
+/**
+ * @brief Adds the product of `m` x `k` matrix `a` and `k` x `n` matrix `b` to
+ * `m` x `n` matrix `c`: C += A * B. The matrices are stored in row-major order
+ * with the leading dimensions `lda`, `ldb` and `ldc`.
+ *
+ * @param m   Rows of `a` and `c`
+ * @param n   Columns of `b` and `c`
+ * @param k   Columns of `a` and rows of `b`
+ * @param a   First matrix
+ * @param lda Leading dimension of `a`
+ * @param b   Last matrix
+ * @param ldb Leading dimension of `b`
+ * @param c   Result
+ * @param ldc Leading dimension of `c`
+ */
+template <typename T>
+void gemm(size_t m, size_t n, size_t k, const T *a, size_t lda, const T *b,
+          size_t ldb, T *c, size_t ldc) {
+  gemm_strided(m, n, k, a, lda, size_t{1}, b, ldb, size_t{1}, c, ldc);
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,735 @@
+/**
+ * @file basic_graph.h
+ * @brief Implements the deferred computation of chains of operations of
+ * matrices. The operations of `deferred` don't compute anything, but record
+ * the nodes of graph. The graph is planned when it's launched:
+ * - the sums, the differences and the products by numbers are computed in one
+ *   pass, and the products of matrices are added to them by the kernel of
+ *   product, so `alpha * A * B + beta * C` is one product into `beta * C`;
+ * - the chains of products are multiplied in the order of the least number
+ *   of operations, e.g. `(A * B) * x` is computed as `A * (B * x)`;
+ * - the independent parts of graph are computed concurrently by the pool.
+ * @code
+ * bez::deferred<double> a = x, b = y, c = z;
+ * std::future<bez::basic_matrix<double>> r = ((a * b + c) / 2.0).launch();
+ * bez::basic_matrix<double> chain = (a * b * c).evaluate();
+ * @endcode
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_GRAPH
+#define BASIC_GRAPH
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_view.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `deferred`, the plan of graph and `launch()`.
+ * * 2026-10-14 V0.2 `launch()` keeps the thread and joins it, instead of
+ *   detaching it.
+ */
+
+namespace bez {
+
+template <typename T>
+class deferred;
+
+namespace detail {
+
+/**
+ * @enum @class graph_op
+ *
+ * @brief Operation of the node of graph.
+ */
+enum class graph_op {
+  input,        // Matrix or view
+  combination,  // Sum of the operands multiplied by the numbers
+  product,      // Product of two matrices
+  divide        // Operand divided by the number, for the integers
+};
+
+/**
+ * @struct graph_node basic_graph.h
+ *
+ * @brief Recorded operation of `rows` x `columns` matrices. The nodes aren't
+ * changed after they are made, so the graphs share them.
+ */
+template <typename T>
+struct graph_node {
+  using pointer = std::shared_ptr<const graph_node>;
+
+  graph_op op;
+  size_t rows;
+  size_t columns;
+  STATUS status{STATUS::GOOD_ALLOCATOR};
+  std::optional<matrix_view<const T>> input;  // Elements of input
+  std::vector<std::pair<T, pointer>> terms;   // Numbers and operands of sum
+  pointer lhs, rhs;                           // Operands of product or divide
+  T divisor{1};
+};
+
+/**
+ * @class graph_plan basic_graph.h
+ *
+ * @brief Steps of computation of the outputs of graph. Every step computes
+ * one matrix: the sum of `terms` and `products` multiplied by the numbers,
+ * which is divided by `divisor` for the integers. The nodes, which are used
+ * once, are merged into the step of their user, other nodes are the steps.
+ *
+ * @details The steps are ordered by their dependencies, and the step of
+ * level `l` depends on the steps of levels less than `l`, so the steps of
+ * the same level are independent. The matrix of step is freed after the
+ * last level which reads it.
+ */
+template <typename T>
+class graph_plan {
+  using node = graph_node<T>;
+  using pointer = typename node::pointer;
+
+  struct term {
+    T coefficient;
+    size_t value;  // Step
+  };
+
+  struct product {
+    T coefficient;
+    size_t lhs, rhs;  // Steps
+  };
+
+  struct step {
+    step(size_t rows, size_t columns) : rows(rows), columns(columns) {}
+
+    size_t rows, columns;
+    std::optional<matrix_view<const T>> input;
+    std::vector<term> terms;
+    std::vector<product> products;
+    std::optional<T> divisor;
+    size_t level = 0;    // Steps of the same level are independent
+    size_t last = 0;     // Last level which reads the matrix
+    size_t outputs = 0;  // Outputs which aren't given yet
+    std::optional<basic_matrix<T>> value;
+  };
+
+  struct output {
+    size_t step;
+    std::promise<basic_matrix<T>> promise;
+    bool ready = false;
+  };
+
+ public:
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /// @brief Plans the computation of `outputs`. The outputs with the error
+  /// status are given at once. @see deferred::status()
+  explicit graph_plan(const std::vector<deferred<T>> &outputs) {
+    for (const deferred<T> &result : outputs)
+      if (result.status() == STATUS::GOOD_ALLOCATOR) {
+        count(result._Node.get());
+        _Outputs.insert(result._Node.get());
+      }
+    for (const deferred<T> &result : outputs) {
+      output &last = _Results.emplace_back();
+      if (result.status() != STATUS::GOOD_ALLOCATOR) {
+        last.step = npos;
+        last.promise.set_value(failed(result.status()));
+        last.ready = true;
+        continue;
+      }
+      last.step = materialize(result._Node);
+      _Steps[last.step].outputs++;
+    }
+    for (const output &result : _Results)
+      if (!result.ready)
+        _Levels = std::max(_Levels, ready_level(_Steps[result.step]) + 1);
+  }
+
+  /// @brief Get the futures of outputs in their order. Called once.
+  std::vector<std::future<basic_matrix<T>>> futures() {
+    std::vector<std::future<basic_matrix<T>>> result;
+    result.reserve(_Results.size());
+    for (output &last : _Results) result.push_back(last.promise.get_future());
+    return result;
+  }
+
+  /**
+   * @brief Computes the steps by their levels and gives the outputs, when
+   * the last level which reads them is computed. If the computation throws,
+   * the outputs take the exception.
+   */
+  void run() {
+    try {
+      std::vector<std::vector<size_t>> levels(_Levels);
+      for (size_t index = 0; index < _Steps.size(); index++)
+        if (_Steps[index].level < _Levels)
+          levels[_Steps[index].level].push_back(index);
+
+      for (size_t level = 0; level < _Levels; level++) {
+        compute(levels[level]);
+        for (output &result : _Results)
+          if (!result.ready && ready_level(_Steps[result.step]) == level)
+            give(result);
+        // The matrices which aren't read anymore
+        for (step &current : _Steps)
+          if (current.value && current.outputs == 0 && current.last <= level)
+            current.value.reset();
+      }
+    } catch (...) {
+      for (output &result : _Results)
+        if (!result.ready)
+          result.promise.set_exception(std::current_exception());
+    }
+  }
+
+ private:
+  /// @brief Counts the users of the nodes of graph.
+  void count(const node *current) {
+    if (_Uses[current]++ > 0) return;
+    for (const auto &[coefficient, operand] : current->terms)
+      count(operand.get());
+    if (current->lhs) count(current->lhs.get());
+    if (current->rhs) count(current->rhs.get());
+  }
+
+  /// @brief Is the node computed by its own step: it's used twice or it's
+  /// the output.
+  bool shared(const node *current) const {
+    return _Uses.at(current) > 1 || _Outputs.contains(current);
+  }
+
+  /// @brief Get the step which computes the node.
+  size_t materialize(const pointer &current) {
+    const auto found = _Step.find(current.get());
+    if (found != _Step.end()) return found->second;
+
+    step result(current->rows, current->columns);
+    switch (current->op) {
+      case graph_op::input:
+        result.input.emplace(*current->input);
+        break;
+      case graph_op::combination:
+        for (const auto &[coefficient, operand] : current->terms)
+          expand(operand, coefficient, result);
+        break;
+      case graph_op::product:
+        multiply(*current, T(1), result);
+        break;
+      case graph_op::divide:
+        expand(current->lhs, T(1), result);
+        result.divisor = current->divisor;
+        break;
+    }
+    const size_t index = add(std::move(result));
+    _Step.emplace(current.get(), index);
+    return index;
+  }
+
+  /// @brief Adds `coefficient * operand` to the step. The sums and the
+  /// products which aren't shared are merged into the step.
+  void expand(const pointer &operand, T coefficient, step &result) {
+    if (!shared(operand.get())) {
+      if (operand->op == graph_op::combination) {
+        for (const auto &[factor, inner] : operand->terms)
+          expand(inner, coefficient * factor, result);
+        return;
+      }
+      if (operand->op == graph_op::product) {
+        multiply(*operand, coefficient, result);
+        return;
+      }
+    }
+    const size_t value = materialize(operand);
+    for (term &existing : result.terms)
+      if (existing.value == value) {
+        existing.coefficient += coefficient;
+        return;
+      }
+    result.terms.push_back({coefficient, value});
+  }
+
+  /// @brief Adds `coefficient * product` to the step. The chain of products
+  /// which aren't shared is multiplied in the best order.
+  void multiply(const node &current, T coefficient, step &result) {
+    std::vector<size_t> factors;
+    collect(current.lhs, factors);
+    collect(current.rhs, factors);
+    const auto [lhs, rhs] = order(factors);
+    result.products.push_back({coefficient, lhs, rhs});
+  }
+
+  /// @brief Get the factors of the chain of products.
+  void collect(const pointer &operand, std::vector<size_t> &factors) {
+    if (operand->op == graph_op::product && !shared(operand.get())) {
+      collect(operand->lhs, factors);
+      collect(operand->rhs, factors);
+      return;
+    }
+    factors.push_back(materialize(operand));
+  }
+
+  /**
+   * @brief Chooses the order of products of the chain of `factors` by the
+   * dynamic programming: the product of matrices `m` x `k` and `k` x `n`
+   * costs `m * n * k` operations.
+   *
+   * @return The steps of the first and the last factors of the last product
+   */
+  std::pair<size_t, size_t> order(const std::vector<size_t> &factors) {
+    const size_t count = factors.size();
+    if (count == 2) return {factors[0], factors[1]};
+
+    // The chain of `i`-th factor is `sizes[i]` x `sizes[i + 1]`
+    std::vector<double> sizes(count + 1);
+    sizes[0] = static_cast<double>(_Steps[factors[0]].rows);
+    for (size_t i = 0; i < count; i++)
+      sizes[i + 1] = static_cast<double>(_Steps[factors[i]].columns);
+
+    std::vector<double> cost(count * count, 0);
+    std::vector<size_t> split(count * count, 0);
+    for (size_t length = 2; length <= count; length++)
+      for (size_t i = 0; i + length <= count; i++) {
+        const size_t j = i + length - 1;
+        cost[i * count + j] = std::numeric_limits<double>::infinity();
+        for (size_t s = i; s < j; s++) {
+          const double total = cost[i * count + s] +
+                               cost[(s + 1) * count + j] +
+                               sizes[i] * sizes[s + 1] * sizes[j + 1];
+          if (total < cost[i * count + j]) {
+            cost[i * count + j] = total;
+            split[i * count + j] = s;
+          }
+        }
+      }
+
+    // The products of the inner parts of chain are their own steps
+    const auto build = [&](auto &self, size_t i, size_t j) -> size_t {
+      if (i == j) return factors[i];
+      const size_t s = split[i * count + j];
+      step inner(_Steps[factors[i]].rows, _Steps[factors[j]].columns);
+      const size_t lhs = self(self, i, s);
+      const size_t rhs = self(self, s + 1, j);
+      inner.products.push_back({T(1), lhs, rhs});
+      return add(std::move(inner));
+    };
+    const size_t s = split[count - 1];
+    const size_t lhs = build(build, 0, s);
+    const size_t rhs = build(build, s + 1, count - 1);
+    return {lhs, rhs};
+  }
+
+  /// @brief Adds the step after the steps which it reads.
+  size_t add(step &&result) {
+    const auto read = [&](size_t value) {
+      result.level = std::max(result.level, _Steps[value].level + 1);
+    };
+    for (const term &operand : result.terms) read(operand.value);
+    for (const product &operand : result.products) {
+      read(operand.lhs);
+      read(operand.rhs);
+    }
+    const auto last = [&](size_t value) {
+      _Steps[value].last = std::max(_Steps[value].last, result.level);
+    };
+    for (const term &operand : result.terms) last(operand.value);
+    for (const product &operand : result.products) {
+      last(operand.lhs);
+      last(operand.rhs);
+    }
+    _Steps.push_back(std::move(result));
+    return _Steps.size() - 1;
+  }
+
+  /// @brief Level after which the output of step is given.
+  static size_t ready_level(const step &current) {
+    return std::max(current.level, current.last);
+  }
+
+  /// @brief Get the elements of step.
+  matrix_view<const T> view(size_t index) const {
+    const step &current = _Steps[index];
+    if (current.input) return *current.input;
+    return std::as_const(*current.value).view();
+  }
+
+  /// @brief Operations of the step, which decide to run it concurrently.
+  static double cost(const step &current, const std::vector<step> &steps) {
+    double total = static_cast<double>(current.rows * current.columns) *
+                   static_cast<double>(current.terms.size() + 1);
+    for (const product &operand : current.products)
+      total += static_cast<double>(current.rows * current.columns) *
+               static_cast<double>(steps[operand.lhs].columns);
+    return total;
+  }
+
+  /**
+   * @brief Computes the steps of one level. The steps are computed
+   * concurrently, if they are enough to take all threads or each of them is
+   * too small to be computed in parallel. Otherwise each step is computed in
+   * parallel after the previous one.
+   */
+  void compute(const std::vector<size_t> &indexes) {
+    std::vector<size_t> work;
+    for (size_t index : indexes)
+      if (!_Steps[index].input) work.push_back(index);
+    if (work.empty()) return;
+
+    const double threshold = static_cast<double>(parallel_threshold());
+    const bool concurrent =
+        work.size() > 1 &&
+        (work.size() >= num_threads() ||
+         std::all_of(work.begin(), work.end(), [&](size_t index) {
+           return cost(_Steps[index], _Steps) < threshold;
+         }));
+    if (concurrent) {
+      default_pool().run(work.size(),
+                         [&](size_t task) { compute(_Steps[work[task]]); });
+    } else {
+      for (size_t index : work) compute(_Steps[index]);
+    }
+  }
+
+  /// @brief Computes the sum of terms, adds the products and divides it.
+  void compute(step &current) {
+    const size_t m = current.rows, n = current.columns;
+    if (current.terms.empty())
+      current.value.emplace(m, n);
+    else
+      current.value.emplace(m, n, uninitialized);
+    T *data = current.value->data();
+    const size_t ld = current.value->stride();
+
+    if (!current.terms.empty()) {
+      BEZ_STATS_OPERATION(expression, m * n, m * n * current.terms.size());
+      parallel_for(
+          m, std::max<size_t>(1, evaluate_grain / (n + 1)),
+          [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++)
+              for (size_t t = 0; t < current.terms.size(); t++)
+                accumulate(current.terms[t], row, t == 0,
+                           data + row * ld, n);
+          },
+          n * current.terms.size());
+    }
+    for (const product &operand : current.products) {
+      const matrix_view<const T> a = view(operand.lhs), b = view(operand.rhs);
+      gemm_strided(m, n, a.columns(), a.data(), a.row_stride(),
+                   a.column_stride(), b.data(), b.row_stride(),
+                   b.column_stride(), data, ld, operand.coefficient);
+    }
+    if (current.divisor) {
+      parallel_for(
+          m, std::max<size_t>(1, evaluate_grain / (n + 1)),
+          [&](size_t begin, size_t end) {
+            for (size_t row = begin; row < end; row++)
+              simd::div(data + row * ld, *current.divisor, data + row * ld,
+                        n);
+          },
+          n);
+    }
+  }
+
+  /// @brief line = coefficient * value(row) for the first term, otherwise
+  /// line += coefficient * value(row).
+  void accumulate(const term &operand, size_t row, bool first, T *line,
+                  size_t n) const {
+    const matrix_view<const T> value = view(operand.value);
+    const T *source = value.data() + row * value.row_stride();
+    const size_t cs = value.column_stride();
+    if (cs == 1) {
+      if (first)
+        simd::mul(source, operand.coefficient, line, n);
+      else
+        simd::axpy(operand.coefficient, source, line, n);
+    } else if (first) {
+      for (size_t j = 0; j < n; j++)
+        line[j] = operand.coefficient * source[j * cs];
+    } else {
+      for (size_t j = 0; j < n; j++)
+        line[j] += operand.coefficient * source[j * cs];
+    }
+  }
+
+  /// @brief Gives the matrix of output. The last output of step takes the
+  /// matrix, other outputs take the copies.
+  void give(output &result) {
+    step &current = _Steps[result.step];
+    if (current.input) {
+      const matrix_view<const T> &value = *current.input;
+      basic_matrix<T> copy(value.rows(), value.columns(), uninitialized);
+      for (size_t row = 0; row < value.rows(); row++)
+        for (size_t column = 0; column < value.columns(); column++)
+          copy.at(row, column) = value.at(row, column);
+      result.promise.set_value(std::move(copy));
+    } else if (--current.outputs == 0) {
+      result.promise.set_value(std::move(*current.value));
+      current.value.reset();
+    } else {
+      result.promise.set_value(basic_matrix<T>(*current.value));
+    }
+    result.ready = true;
+  }
+
+  /// @brief Matrix with one element of zero and the error status like the
+  /// product of matrices of wrong shapes. @see basic_matrix::operator*()
+  static basic_matrix<T> failed(STATUS status) {
+    basic_matrix<T> matrix(1, 1);
+    matrix._Status = status;
+    return matrix;
+  }
+
+  std::vector<step> _Steps;
+  std::vector<output> _Results;
+  std::unordered_map<const node *, size_t> _Uses;  // Users of nodes
+  std::unordered_map<const node *, size_t> _Step;  // Steps of nodes
+  std::unordered_set<const node *> _Outputs;
+  size_t _Levels = 0;
+};
+
+/**
+ * @class graph_launches basic_graph.h
+ *
+ * @brief Threads of the launched graphs. The handles are kept, so no thread
+ * outlives the program: the finished threads are joined by the next launch,
+ * the others are joined at the exit before the pool of the library is
+ * destroyed. @see launches()
+ */
+class graph_launches {
+ public:
+  graph_launches() = default;
+  graph_launches(const graph_launches &) = delete;
+  graph_launches &operator=(const graph_launches &) = delete;
+
+  /// @brief Waits for the threads.
+  ~graph_launches() {
+    std::lock_guard lock(_Mutex);
+    for (std::future<void> &run : _Runs) run.wait();
+  }
+
+  /// @brief Computes `task` on the new thread.
+  void add(std::function<void()> task) {
+    std::lock_guard lock(_Mutex);
+    std::erase_if(_Runs, [](const std::future<void> &run) {
+      return run.wait_for(std::chrono::seconds(0)) ==
+             std::future_status::ready;
+    });
+    _Runs.push_back(std::async(std::launch::async, std::move(task)));
+  }
+
+ private:
+  std::mutex _Mutex;
+  std::vector<std::future<void>> _Runs;
+};
+
+/// @brief Get the threads of the launched graphs. They are made after the
+/// pool, so they are joined before the pool is destroyed.
+inline graph_launches &launches() {
+  default_pool();
+  static graph_launches instance;
+  return instance;
+}
+
+}  // namespace detail
+
+/**
+ * @class deferred basic_graph.h
+ *
+ * @brief Matrix which isn't computed yet: the node of graph of operations.
+ * The operations `+`, `-`, `*` and `/` by a number record the new nodes,
+ * and `evaluate()` or `launch()` compute the graph. The shapes are checked
+ * when the operations are recorded: the node of operands of wrong shapes
+ * takes the error status, and its result is the matrix with one element of
+ * zero and the status.
+ *
+ * @note The inputs keep the pointers to the memory of matrices, like the
+ * expressions. The matrices must live until the results are computed.
+ *
+ * @tparam T Number
+ */
+template <typename T>
+class deferred {
+  using node = detail::graph_node<T>;
+
+ public:
+  using value_type = T;
+
+  /// @brief Input of the elements of matrix.
+  deferred(const basic_matrix<T> &matrix) : deferred(matrix.view()) {}
+
+  /// @brief Input of the elements of view, e.g. `matrix.transpose()`.
+  deferred(matrix_view<const T> view) {
+    auto result = std::make_shared<node>();
+    result->op = detail::graph_op::input;
+    result->rows = view.rows();
+    result->columns = view.columns();
+    result->status = view.status();
+    result->input.emplace(view);
+    _Node = std::move(result);
+  }
+
+  /// @see deferred(matrix_view<const T>)
+  deferred(matrix_view<T> view) : deferred(matrix_view<const T>(view)) {}
+
+  size_t rows() const { return _Node->rows; }
+  size_t columns() const { return _Node->columns; }
+
+  /// @brief Get the error status of the operation or of its operands.
+  STATUS status() const { return _Node->status; }
+
+  /// @brief Computes the matrix on the current thread. @see launch()
+  basic_matrix<T> evaluate() const {
+    detail::graph_plan<T> plan({*this});
+    auto result = plan.futures();
+    plan.run();
+    return result.front().get();
+  }
+
+  /// @brief Computes the matrix on the other thread. @see bez::launch()
+  std::future<basic_matrix<T>> launch() const;
+
+  friend deferred operator+(const deferred &lhs, const deferred &rhs) {
+    return combine(lhs, T(1), rhs, T(1));
+  }
+
+  friend deferred operator-(const deferred &lhs, const deferred &rhs) {
+    return combine(lhs, T(1), rhs, T(-1));
+  }
+
+  friend deferred operator-(const deferred &value) {
+    return scale(value, T(-1));
+  }
+
+  friend deferred operator*(const deferred &value, T k) {
+    return scale(value, k);
+  }
+
+  friend deferred operator*(T k, const deferred &value) {
+    return scale(value, k);
+  }
+
+  /// @brief Division by a number. The float point numbers are multiplied by
+  /// `1 / k`, so the division is merged into the sums. If k = 0, the node
+  /// takes the status `STATUS::DIVIDED_ZERO`.
+  friend deferred operator/(const deferred &value, T k) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (k != 0) return scale(value, T(1) / k);
+    }
+    auto result = make(detail::graph_op::divide, value.rows(),
+                       value.columns(), value.status());
+    if (result->status == STATUS::GOOD_ALLOCATOR && k == 0)
+      result->status = STATUS::DIVIDED_ZERO;
+    result->lhs = value._Node;
+    result->divisor = k;
+    return deferred(std::move(result));
+  }
+
+  /// @brief Product of matrices. If the columns of `lhs` aren't equal to the
+  /// rows of `rhs`, the node takes the status `STATUS::BOUND_ARRAY`.
+  friend deferred operator*(const deferred &lhs, const deferred &rhs) {
+    auto result = make(detail::graph_op::product, lhs.rows(), rhs.columns(),
+                       first_error(lhs, rhs));
+    if (result->status == STATUS::GOOD_ALLOCATOR && lhs.columns() != rhs.rows())
+      result->status = STATUS::BOUND_ARRAY;
+    result->lhs = lhs._Node;
+    result->rhs = rhs._Node;
+    return deferred(std::move(result));
+  }
+
+ private:
+  explicit deferred(std::shared_ptr<const node> pointer)
+      : _Node(std::move(pointer)) {}
+
+  static std::shared_ptr<node> make(detail::graph_op op, size_t rows,
+                                    size_t columns, STATUS status) {
+    auto result = std::make_shared<node>();
+    result->op = op;
+    result->rows = rows;
+    result->columns = columns;
+    result->status = status;
+    return result;
+  }
+
+  static STATUS first_error(const deferred &lhs, const deferred &rhs) {
+    return lhs.status() != STATUS::GOOD_ALLOCATOR ? lhs.status()
+                                                  : rhs.status();
+  }
+
+  /// @brief lhs * a + rhs * b. If the shapes are different, the node takes
+  /// the status `STATUS::BOUND_ARRAY`.
+  static deferred combine(const deferred &lhs, T a, const deferred &rhs,
+                          T b) {
+    auto result = make(detail::graph_op::combination, lhs.rows(),
+                       lhs.columns(), first_error(lhs, rhs));
+    if (result->status == STATUS::GOOD_ALLOCATOR &&
+        (lhs.rows() != rhs.rows() || lhs.columns() != rhs.columns()))
+      result->status = STATUS::BOUND_ARRAY;
+    result->terms = {{a, lhs._Node}, {b, rhs._Node}};
+    return deferred(std::move(result));
+  }
+
+  static deferred scale(const deferred &value, T k) {
+    auto result = make(detail::graph_op::combination, value.rows(),
+                       value.columns(), value.status());
+    result->terms = {{k, value._Node}};
+    return deferred(std::move(result));
+  }
+
+  friend class detail::graph_plan<T>;
+
+  std::shared_ptr<const node> _Node;
+};
+
+/**
+ * @brief Computes the outputs of graph on the other thread. The nodes which
+ * are shared by the outputs are computed once. Each future is ready when
+ * its matrix is computed, before the whole graph. The thread is joined by
+ * the library, at the latest at the exit, so the inputs must live until all
+ * futures are ready, even if the futures are dropped.
+ *
+ * @param outputs Results of operations
+ * @return Futures of the matrices of `outputs` in their order
+ */
+template <typename T>
+std::vector<std::future<basic_matrix<T>>> launch(
+    const std::vector<deferred<T>> &outputs) {
+  auto plan = std::make_shared<detail::graph_plan<T>>(outputs);
+  auto result = plan->futures();
+  detail::launches().add([plan] { plan->run(); });
+  return result;
+}
+
+template <typename T>
+std::future<basic_matrix<T>> deferred<T>::launch() const {
+  return std::move(bez::launch(std::vector<deferred<T>>{*this}).front());
+}
+
+}  // namespace bez
+#endif
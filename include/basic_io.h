@@ -0,0 +1,426 @@
+/**
+ * @file basic_io.h
+ * @brief Implements the binary file of basic_vector and basic_matrix and the
+ * mapping of the file to the memory. The elements are written and read as
+ * one block without formatting, the mapped file is used without copying.
+ *
+ * @version 0.4
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_IO
+#define BASIC_IO
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "basic_matrix.h"
+#include "basic_memory.h"
+#include "basic_types.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BEZ_IO_MMAP 1
+#else
+#define BEZ_IO_MMAP 0
+#endif
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the binary file and `mapped_file`.
+ * * 2026-10-14 V0.2 Added the types of reduced precision.
+ * * 2026-10-14 V0.3 The size of file is checked before the header is read,
+ *   the size of elements of the header is checked for the overflow.
+ * * 2026-10-14 V0.4 load() checks the offset of elements like mapped_file,
+ *   mapped_file checks the alignment of elements.
+ */
+
+namespace bez {
+
+/**
+ * @enum @class dtype
+ *
+ * @brief Type of elements of the binary file.
+ */
+enum class dtype : uint8_t {
+  unknown,
+  int8,
+  uint8,
+  int16,
+  uint16,
+  int32,
+  uint32,
+  int64,
+  uint64,
+  float32,
+  float64,
+  float16,
+  bfloat16
+};
+
+/// @brief Get the type of elements of the binary file for the type `T`.
+template <typename T>
+constexpr dtype dtype_of() {
+  if constexpr (std::is_same_v<T, float>)
+    return dtype::float32;
+  else if constexpr (std::is_same_v<T, double>)
+    return dtype::float64;
+  else if constexpr (std::is_same_v<T, float16>)
+    return dtype::float16;
+  else if constexpr (std::is_same_v<T, bfloat16>)
+    return dtype::bfloat16;
+  else if constexpr (std::is_same_v<T, int8>)
+    return dtype::int8;
+  else if constexpr (std::is_integral_v<T> && sizeof(T) == 1)
+    return std::is_signed_v<T> ? dtype::int8 : dtype::uint8;
+  else if constexpr (std::is_integral_v<T> && sizeof(T) == 2)
+    return std::is_signed_v<T> ? dtype::int16 : dtype::uint16;
+  else if constexpr (std::is_integral_v<T> && sizeof(T) == 4)
+    return std::is_signed_v<T> ? dtype::int32 : dtype::uint32;
+  else if constexpr (std::is_integral_v<T> && sizeof(T) == 8)
+    return std::is_signed_v<T> ? dtype::int64 : dtype::uint64;
+  else
+    return dtype::unknown;
+}
+
+/**
+ * @struct file_header basic_io.h
+ *
+ * @brief Header of the binary file. It's followed by the padding up to
+ * `offset` and `rows * columns` elements in row-major order. The vector is
+ * stored as the matrix 1 x length with `rank` = 1.
+ *
+ * @details The numbers are in the byte order of the machine which wrote the
+ * file, `little_endian` defines it. The `offset` is a multiple of
+ * `alignment`, so the elements of the mapped file are aligned.
+ */
+struct file_header {
+  char magic[4]{'B', 'E', 'Z', 'M'};  // Signature of format
+  uint16_t version{1};                // Version of format
+  dtype type{dtype::unknown};         // Type of elements
+  uint8_t rank{0};                    // 1 for vector, 2 for matrix
+  uint8_t little_endian{std::endian::native == std::endian::little};
+  uint8_t element_size{0};            // Size of element in bytes
+  uint16_t reserved{0};               // Zero
+  uint32_t alignment{BEZ_MEMORY_ALIGNMENT};  // Alignment of elements
+  uint64_t rows{0};                   // Rows of matrix, 1 for vector
+  uint64_t columns{0};                // Columns of matrix, length of vector
+  uint64_t offset{0};                 // Offset of elements in bytes
+  uint8_t padding[24]{};              // Zero
+
+  /// @brief Size of elements in bytes. @see sized()
+  constexpr uint64_t size() const { return rows * columns * element_size; }
+
+  /// @brief Does `size()` fit in `size_t` without the overflow, which the
+  /// damaged or crafted header may cause.
+  constexpr bool sized() const {
+    constexpr uint64_t limit = std::numeric_limits<size_t>::max();
+    if (rows != 0 && columns > limit / rows) return false;
+    return element_size == 0 || rows * columns <= limit / element_size;
+  }
+
+  /// @brief Are the elements after the header inside the file of `bytes`
+  /// bytes. The damaged `offset` may point into the header or past the end.
+  constexpr bool fits(uint64_t bytes) const {
+    return sized() && offset >= sizeof(file_header) && offset <= bytes &&
+           size() <= bytes - offset;
+  }
+
+  /// @brief Can the file be read as the elements of the type `T`. The vector
+  /// has one row.
+  template <typename T>
+  bool valid(uint8_t expected_rank) const {
+    return std::memcmp(magic, "BEZM", 4) == 0 && version == 1 && sized() &&
+           (expected_rank != 1 || rows == 1) &&
+           type == dtype_of<T>() && element_size == sizeof(T) &&
+           rank == expected_rank &&
+           little_endian == (std::endian::native == std::endian::little);
+  }
+};
+
+static_assert(sizeof(file_header) == 64, "Header must be of 64 bytes");
+
+namespace detail {
+
+/// @brief Get the header of matrix `rows` x `columns` of the type `T`.
+template <typename T>
+file_header make_header(uint8_t rank, size_t rows, size_t columns) {
+  file_header header;
+  header.type = dtype_of<T>();
+  header.rank = rank;
+  header.element_size = sizeof(T);
+  header.rows = rows;
+  header.columns = columns;
+  header.offset = (sizeof(file_header) + BEZ_MEMORY_ALIGNMENT - 1) /
+                  BEZ_MEMORY_ALIGNMENT * BEZ_MEMORY_ALIGNMENT;
+  return header;
+}
+
+/// @brief Writes the header and the padding up to the elements.
+inline bool write_header(std::ofstream &file, const file_header &header) {
+  static const char zeros[BEZ_MEMORY_ALIGNMENT] = {};
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(zeros, header.offset - sizeof(header));
+  return file.good();
+}
+
+/// @brief Reads the header and goes to the elements, if they are inside the
+/// file. @see file_header::fits()
+template <typename T>
+bool read_header(std::ifstream &file, file_header &header, uint8_t rank) {
+  file.seekg(0, std::ios::end);
+  const std::streamoff end = file.tellg();
+  file.seekg(0);
+  if (end < 0) return false;
+  file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!file || !header.valid<T>(rank) ||
+      !header.fits(static_cast<uint64_t>(end)))
+    return false;
+  file.seekg(static_cast<std::streamoff>(header.offset));
+  return file.good();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Writes the vector to the binary file. @see file_header
+ *
+ * @param path   Path of file
+ * @param vector Vector
+ * @return `STATUS::BAD_FILE`, if the file isn't written
+ */
+template <number T>
+STATUS save(const std::string &path, const basic_vector<T> &vector) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  const file_header header = detail::make_header<T>(1, 1, vector.length());
+  if (!file || !detail::write_header(file, header)) return STATUS::BAD_FILE;
+  file.write(reinterpret_cast<const char *>(vector.data()),
+             static_cast<std::streamsize>(vector.length() * sizeof(T)));
+  return file.good() ? STATUS::GOOD_ALLOCATOR : STATUS::BAD_FILE;
+}
+
+/**
+ * @brief Writes the matrix to the binary file row by row. @see file_header
+ *
+ * @param path   Path of file
+ * @param matrix Matrix
+ * @return `STATUS::BAD_FILE`, if the file isn't written
+ */
+template <typename T>
+STATUS save(const std::string &path, const basic_matrix<T> &matrix) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  const file_header header =
+      detail::make_header<T>(2, matrix.rows(), matrix.columns());
+  if (!file || !detail::write_header(file, header)) return STATUS::BAD_FILE;
+
+  const auto bytes = static_cast<std::streamsize>(header.columns * sizeof(T));
+  if (matrix.stride() == matrix.columns())
+    file.write(reinterpret_cast<const char *>(matrix.data()),
+               bytes * static_cast<std::streamsize>(matrix.rows()));
+  else
+    for (size_t row = 0; row < matrix.rows(); row++)
+      file.write(reinterpret_cast<const char *>(matrix.data() +
+                                                row * matrix.stride()),
+                 bytes);
+  return file.good() ? STATUS::GOOD_ALLOCATOR : STATUS::BAD_FILE;
+}
+
+/**
+ * @brief Reads the vector of the binary file with one read. If the file isn't
+ * read, the vector isn't changed.
+ *
+ * @param path   Path of file
+ * @param vector Result
+ * @return `STATUS::BAD_FILE`, if the file isn't read or it has other type
+ */
+template <number T>
+STATUS load(const std::string &path, basic_vector<T> &vector) {
+  std::ifstream file(path, std::ios::binary);
+  file_header header;
+  if (!file || !detail::read_header<T>(file, header, 1))
+    return STATUS::BAD_FILE;
+
+  basic_vector<T> result(header.columns, uninitialized);
+  if (result.status() != STATUS::GOOD_ALLOCATOR) return result.status();
+  file.read(reinterpret_cast<char *>(result.data()),
+            static_cast<std::streamsize>(header.size()));
+  if (!file) return STATUS::BAD_FILE;
+
+  vector = std::move(result);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/// @brief Reads the matrix of the binary file. @see load()
+template <typename T>
+STATUS load(const std::string &path, basic_matrix<T> &matrix) {
+  std::ifstream file(path, std::ios::binary);
+  file_header header;
+  if (!file || !detail::read_header<T>(file, header, 2))
+    return STATUS::BAD_FILE;
+
+  basic_matrix<T> result(header.rows, header.columns, uninitialized);
+  if (result.status() != STATUS::GOOD_ALLOCATOR) return result.status();
+  file.read(reinterpret_cast<char *>(result.data()),
+            static_cast<std::streamsize>(header.size()));
+  if (!file) return STATUS::BAD_FILE;
+
+  matrix = std::move(result);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @class mapped_file basic_io.h
+ *
+ * @brief Binary file mapped to the memory. The vector or the matrix of the
+ * file refers to the mapped memory without copying, the pages are read on the
+ * first access. @see file_header
+ *
+ * @details By default the changes of elements are private and aren't written
+ * to the file. If `shared` is set, the changes are written to the file. The
+ * vectors and matrices of the file must not live longer than the mapping.
+ * Without `mmap` the file is read to the memory. If the file isn't mapped or
+ * has other type, `status()` is `STATUS::BAD_FILE`.
+ * @code
+ * bez::mapped_file file("weights.bez");
+ * bez::basic_matrix<float> weights = file.matrix<float>();
+ * if (file.status() != bez::STATUS::GOOD_ALLOCATOR) ...
+ * @endcode
+ */
+class mapped_file {
+ private:
+  void *_Memory{nullptr};  // Mapped file
+  size_t _Size{0};         // Size of file in bytes
+  file_header _Header;     // Header of file
+  mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+#if !BEZ_IO_MMAP
+  detail::aligned_buffer<char> _Buffer;  // Read file without `mmap`
+#endif
+
+ public:
+  /**
+   * @brief Maps the file to the memory.
+   *
+   * @param path   Path of file
+   * @param shared Write the changes to the file
+   */
+  explicit mapped_file(const std::string &path, bool shared = false) {
+#if BEZ_IO_MMAP
+    const int fd = ::open(path.c_str(), shared ? O_RDWR : O_RDONLY);
+    struct stat info;
+    if (fd < 0 || ::fstat(fd, &info) != 0 ||
+        static_cast<size_t>(info.st_size) < sizeof(file_header)) {
+      if (fd >= 0) ::close(fd);
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    _Size = static_cast<size_t>(info.st_size);
+    void *memory = ::mmap(nullptr, _Size, PROT_READ | PROT_WRITE,
+                          shared ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    _Memory = memory;
+#else
+    (void)shared;
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    const std::streamoff end = file.tellg();
+    if (end < static_cast<std::streamoff>(sizeof(file_header))) {
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    _Size = static_cast<size_t>(end);
+    _Buffer = detail::allocate_aligned<char>(_Size);
+    file.seekg(0);
+    file.read(_Buffer.get(), static_cast<std::streamsize>(_Size));
+    if (!file) {
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    _Memory = _Buffer.get();
+#endif
+    // The size of file is checked above, so the header is read in bounds
+    std::memcpy(&_Header, _Memory, sizeof(_Header));
+    if (!_Header.fits(_Size)) _Status = STATUS::BAD_FILE;
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  /// @brief Unmaps the file.
+  ~mapped_file() {
+#if BEZ_IO_MMAP
+    if (_Memory != nullptr) ::munmap(_Memory, _Size);
+#endif
+  }
+
+  /// @brief Get the header of file.
+  const file_header &header() const { return _Header; }
+
+  STATUS status() const { return _Status; }
+
+  const std::string to_string_status() const { return to_string(_Status); }
+
+  /**
+   * @brief Get the vector which refers to the elements of file. If the file
+   * has other type, returns the empty vector with `STATUS::BAD_FILE`.
+   *
+   * @return Vector of external memory
+   */
+  template <number T>
+  basic_vector<T> vector() const {
+    if (!valid<T>(1)) return basic_vector<T>(nullptr, 0, external);
+    return basic_vector<T>(elements<T>(), _Header.columns, external);
+  }
+
+  /// @brief Get the matrix which refers to the elements of file. @see vector()
+  template <typename T>
+  basic_matrix<T> matrix() const {
+    if (!valid<T>(2)) return basic_matrix<T>(nullptr, 0, 0, 0, external);
+    return basic_matrix<T>(elements<T>(), _Header.rows, _Header.columns,
+                           _Header.columns, external);
+  }
+
+ private:
+  // The memory is aligned to the page or to the cache line, so the elements
+  // are aligned if their offset is
+  template <typename T>
+  bool valid(uint8_t rank) const {
+    if (_Status == STATUS::GOOD_ALLOCATOR && _Header.valid<T>(rank) &&
+        _Header.offset % alignof(T) == 0)
+      return true;
+    _Status = STATUS::BAD_FILE;
+    return false;
+  }
+
+  template <typename T>
+  T *elements() const {
+    return reinterpret_cast<T *>(static_cast<char *>(_Memory) +
+                                 _Header.offset);
+  }
+};
+
+}  // namespace bez
+
+#undef BEZ_IO_MMAP
+#endif
@@ -0,0 +1,577 @@
+/**
+ * @file basic_linalg.h
+ * @brief Implements the decompositions of dense matrices in place: LU with
+ * partial pivoting, Cholesky and Householder QR, and `solve()`, `inverse()`
+ * and `det()` on top of them. The decompositions are blocked: the panels of
+ * `factor_block` columns are factored by the vectorized kernels, and the rest
+ * of matrix is updated by the blocked product of matrices, which takes most
+ * of the time. @see gemm_strided()
+ * @code
+ * bez::basic_matrix<double> a = ...;
+ * bez::basic_vector<double> b = ...;
+ * bez::solve(a, b);  // b = a^-1 * b
+ *
+ * std::vector<size_t> pivots(a.rows());
+ * bez::lu_factor(a, std::span(pivots));  // a = P * L * U
+ * bez::lu_solve(a, std::span<const size_t>(pivots), b);
+ * @endcode
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_LINALG
+#define BASIC_LINALG
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "basic_gemm.h"
+#include "basic_matrix.h"
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_vector.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the blocked LU, Cholesky and QR, `solve()`,
+ *   `inverse()` and `det()`.
+ */
+
+namespace bez {
+
+/// @brief Columns of the panel of the blocked decompositions.
+inline constexpr size_t factor_block = 64;
+
+namespace detail {
+
+/// @brief Columns of the range [begin, end), which is computed by one thread.
+inline size_t column_grain(size_t columns) {
+  const size_t ranges = 4 * num_threads();
+  return std::max<size_t>(64, (columns + ranges - 1) / ranges);
+}
+
+/**
+ * @brief Factors the panel of `nb` columns from `k` of the rows [k, m)
+ * without blocking. The rows of pivots are swapped in whole. The columns
+ * right to the panel aren't updated.
+ *
+ * @return Are the pivots nonzero
+ */
+template <std::floating_point T>
+bool lu_panel(basic_matrix<T> &a, size_t k, size_t nb, size_t *pivots) {
+  const size_t m = a.rows(), n = a.columns(), ld = a.stride();
+  T *data = a.data();
+  bool regular = true;
+  for (size_t j = k; j < k + nb; j++) {
+    size_t pivot = j;
+    T best = std::abs(data[j * ld + j]);
+    for (size_t i = j + 1; i < m; i++)
+      if (std::abs(data[i * ld + j]) > best) {
+        best = std::abs(data[i * ld + j]);
+        pivot = i;
+      }
+    pivots[j] = pivot;
+    if (pivot != j)
+      std::swap_ranges(data + j * ld, data + j * ld + n, data + pivot * ld);
+
+    const T diagonal = data[j * ld + j];
+    if (diagonal == 0) {
+      regular = false;
+      continue;
+    }
+    const T *line = data + j * ld + j + 1;
+    for (size_t i = j + 1; i < m; i++) {
+      T *row = data + i * ld;
+      row[j] /= diagonal;
+      if (row[j] != 0) simd::axpy(-row[j], line, row + j + 1, k + nb - j - 1);
+    }
+  }
+  return regular;
+}
+
+/**
+ * @brief Computes the Householder reflector of the column `j` of the rows
+ * [j, m): H = I - tau * v * v^T, H * x = (beta, 0, ..., 0). `v` with the
+ * implicit first element 1 is stored below the diagonal, `beta` on it.
+ *
+ * @return Factor `tau`
+ */
+template <std::floating_point T>
+T householder(basic_matrix<T> &a, size_t j) {
+  const size_t m = a.rows(), ld = a.stride();
+  T *data = a.data();
+  T norm = 0;
+  for (size_t i = j + 1; i < m; i++)
+    norm += data[i * ld + j] * data[i * ld + j];
+  if (norm == 0) return 0;
+
+  const T alpha = data[j * ld + j];
+  const T beta = -std::copysign(std::sqrt(alpha * alpha + norm), alpha);
+  const T scale = 1 / (alpha - beta);
+  for (size_t i = j + 1; i < m; i++) data[i * ld + j] *= scale;
+  data[j * ld + j] = beta;
+  return (beta - alpha) / beta;
+}
+
+/**
+ * @brief Applies the reflector of the column `j` to the columns [begin, end)
+ * of the rows [j, m): A = H * A. `w` is the buffer of `end - begin` elements.
+ */
+template <std::floating_point T>
+void apply_householder(basic_matrix<T> &a, size_t j, T tau, size_t begin,
+                       size_t end, T *w) {
+  if (tau == 0 || begin >= end) return;
+  const size_t m = a.rows(), ld = a.stride(), length = end - begin;
+  T *data = a.data();
+  std::copy(data + j * ld + begin, data + j * ld + end, w);
+  for (size_t i = j + 1; i < m; i++)
+    simd::axpy(data[i * ld + j], data + i * ld + begin, w, length);
+  simd::axpy(-tau, w, data + j * ld + begin, length);
+  for (size_t i = j + 1; i < m; i++)
+    simd::axpy(-tau * data[i * ld + j], w, data + i * ld + begin, length);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Factors `m` x `n` matrix in place with the partial pivoting:
+ * A = P * L * U. The unit lower triangular `L` is stored below the diagonal,
+ * the upper triangular `U` on and above the diagonal. The row `j` was swapped
+ * with the row `pivots[j]` at the step `j`.
+ *
+ * @details The panels are factored by the right-looking algorithm, the block
+ * rows of `U` are solved in parallel and the rest of matrix is updated by
+ * gemm_strided(). If a pivot is zero, the factoring continues, so `U` is
+ * singular.
+ *
+ * @param a      Matrix, then its factors
+ * @param pivots Swapped rows of `min(m, n)` elements
+ * @return `STATUS::BOUND_ARRAY` if `pivots` is short, `STATUS::SINGULAR` if
+ * `U` has zero on the diagonal, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS lu_factor(basic_matrix<T> &a, std::span<size_t> pivots) {
+  const size_t m = a.rows(), n = a.columns(), ld = a.stride();
+  const size_t steps = std::min(m, n);
+  if (pivots.size() < steps) return STATUS::BOUND_ARRAY;
+  T *data = a.data();
+  bool regular = true;
+
+  for (size_t k = 0; k < steps; k += factor_block) {
+    const size_t kb = std::min(factor_block, steps - k);
+    regular &= detail::lu_panel(a, k, kb, pivots.data());
+    const size_t next = k + kb;
+    if (next >= n) continue;
+
+    // U12 = L11^-1 * A12 by the ranges of columns
+    parallel_for(
+        n - next, detail::column_grain(n - next),
+        [&](size_t begin, size_t end) {
+          for (size_t i = k + 1; i < next; i++) {
+            T *row = data + i * ld + next + begin;
+            for (size_t p = k; p < i; p++)
+              simd::axpy(-data[i * ld + p], data + p * ld + next + begin, row,
+                         end - begin);
+          }
+        },
+        kb * kb);
+
+    // A22 -= L21 * U12
+    if (next < m)
+      gemm_strided(m - next, n - next, kb, data + next * ld + k, ld, size_t{1},
+                   data + k * ld + next, ld, size_t{1},
+                   data + next * ld + next, ld, T(-1));
+  }
+  return regular ? STATUS::GOOD_ALLOCATOR : STATUS::SINGULAR;
+}
+
+/**
+ * @brief Solves A * X = B by the factors of lu_factor(). The right-hand
+ * sides are the columns of `b`, which is replaced by the solution.
+ *
+ * @param lu     Factors of `n` x `n` matrix
+ * @param pivots Swapped rows of lu_factor()
+ * @param b      `n` x `r` matrix, then the solution
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, `STATUS::SINGULAR`
+ * if `U` is singular, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS lu_solve(const basic_matrix<T> &lu, std::span<const size_t> pivots,
+                basic_matrix<T> &b) {
+  const size_t n = lu.rows(), r = b.columns(), ld = lu.stride();
+  if (lu.columns() != n || b.rows() != n || pivots.size() < n)
+    return STATUS::BOUND_ARRAY;
+  const T *data = lu.data();
+  for (size_t i = 0; i < n; i++)
+    if (data[i * ld + i] == 0) return STATUS::SINGULAR;
+
+  T *x = b.data();
+  const size_t ldb = b.stride();
+  for (size_t j = 0; j < n; j++)
+    if (pivots[j] != j)
+      std::swap_ranges(x + j * ldb, x + j * ldb + r, x + pivots[j] * ldb);
+
+  parallel_for(
+      r, detail::column_grain(r),
+      [&](size_t begin, size_t end) {
+        const size_t length = end - begin;
+        for (size_t i = 1; i < n; i++)
+          for (size_t p = 0; p < i; p++)
+            simd::axpy(-data[i * ld + p], x + p * ldb + begin,
+                       x + i * ldb + begin, length);
+        for (size_t i = n; i-- > 0;) {
+          T *row = x + i * ldb + begin;
+          for (size_t p = i + 1; p < n; p++)
+            simd::axpy(-data[i * ld + p], x + p * ldb + begin, row, length);
+          simd::div(row, data[i * ld + i], row, length);
+        }
+      },
+      n * n);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/// @brief Solves A * x = b by the factors of lu_factor(). @see lu_solve()
+template <std::floating_point T>
+STATUS lu_solve(const basic_matrix<T> &lu, std::span<const size_t> pivots,
+                basic_vector<T> &b) {
+  const size_t n = lu.rows(), ld = lu.stride();
+  if (lu.columns() != n || b.length() != n || pivots.size() < n)
+    return STATUS::BOUND_ARRAY;
+  const T *data = lu.data();
+  for (size_t i = 0; i < n; i++)
+    if (data[i * ld + i] == 0) return STATUS::SINGULAR;
+
+  T *x = b.data();
+  for (size_t j = 0; j < n; j++) std::swap(x[j], x[pivots[j]]);
+  for (size_t i = 1; i < n; i++) x[i] -= simd::dot(data + i * ld, x, i);
+  for (size_t i = n; i-- > 0;)
+    x[i] = (x[i] - simd::dot(data + i * ld + i + 1, x + i + 1, n - i - 1)) /
+           data[i * ld + i];
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Factors the symmetric positive definite matrix in place:
+ * A = L * L^T. The lower triangular `L` is stored on and below the diagonal,
+ * the elements above the diagonal are zeros. Only the lower triangle of `a`
+ * is read.
+ *
+ * @details The diagonal block is factored without blocking, the rows below it
+ * are solved in parallel, and the lower triangle of the rest is updated by
+ * gemm_strided() with the transposed panel.
+ *
+ * @param a Matrix, then its factor
+ * @return `STATUS::BOUND_ARRAY` if the matrix isn't square,
+ * `STATUS::SINGULAR` if it isn't positive definite, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS cholesky_factor(basic_matrix<T> &a) {
+  const size_t n = a.rows(), ld = a.stride();
+  if (a.columns() != n) return STATUS::BOUND_ARRAY;
+  T *data = a.data();
+
+  for (size_t k = 0; k < n; k += factor_block) {
+    const size_t kb = std::min(factor_block, n - k);
+    const size_t next = k + kb;
+
+    // The previous panels are subtracted, so the sums are within the panel
+    for (size_t j = k; j < next; j++) {
+      const T *line = data + j * ld + k;
+      const T diagonal = data[j * ld + j] - simd::dot(line, line, j - k);
+      if (!(diagonal > 0)) return STATUS::SINGULAR;
+      data[j * ld + j] = std::sqrt(diagonal);
+      for (size_t i = j + 1; i < next; i++)
+        data[i * ld + j] =
+            (data[i * ld + j] - simd::dot(data + i * ld + k, line, j - k)) /
+            data[j * ld + j];
+    }
+    if (next >= n) continue;
+
+    // L21 = A21 * L11^-T by the rows
+    parallel_for(
+        n - next, std::max<size_t>(1, detail::evaluate_grain / (kb * kb)),
+        [&](size_t begin, size_t end) {
+          for (size_t i = next + begin; i < next + end; i++) {
+            T *row = data + i * ld + k;
+            for (size_t j = 0; j < kb; j++)
+              row[j] = (row[j] - simd::dot(row, data + (k + j) * ld + k, j)) /
+                       data[(k + j) * ld + k + j];
+          }
+        },
+        kb * kb);
+
+    // A22 -= L21 * L21^T by the block rows of the lower triangle
+    for (size_t ib = next; ib < n; ib += factor_block) {
+      const size_t rows = std::min(factor_block, n - ib);
+      gemm_strided(rows, ib + rows - next, kb, data + ib * ld + k, ld,
+                   size_t{1}, data + next * ld + k, size_t{1}, ld,
+                   data + ib * ld + next, ld, T(-1));
+    }
+  }
+
+  for (size_t i = 0; i < n; i++)
+    std::fill(data + i * ld + i + 1, data + i * ld + n, T(0));
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Solves A * X = B by the factor of cholesky_factor(). The right-hand
+ * sides are the columns of `b`, which is replaced by the solution.
+ *
+ * @param l Factor of `n` x `n` matrix
+ * @param b `n` x `r` matrix, then the solution
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS cholesky_solve(const basic_matrix<T> &l, basic_matrix<T> &b) {
+  const size_t n = l.rows(), r = b.columns(), ld = l.stride();
+  if (l.columns() != n || b.rows() != n) return STATUS::BOUND_ARRAY;
+  const T *data = l.data();
+  T *x = b.data();
+  const size_t ldb = b.stride();
+
+  parallel_for(
+      r, detail::column_grain(r),
+      [&](size_t begin, size_t end) {
+        const size_t length = end - begin;
+        for (size_t i = 0; i < n; i++) {
+          T *row = x + i * ldb + begin;
+          for (size_t p = 0; p < i; p++)
+            simd::axpy(-data[i * ld + p], x + p * ldb + begin, row, length);
+          simd::div(row, data[i * ld + i], row, length);
+        }
+        // L^T * X = Y: the solved row is subtracted from the rows above
+        for (size_t i = n; i-- > 0;) {
+          T *row = x + i * ldb + begin;
+          simd::div(row, data[i * ld + i], row, length);
+          for (size_t p = 0; p < i; p++)
+            simd::axpy(-data[i * ld + p], row, x + p * ldb + begin, length);
+        }
+      },
+      n * n);
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/// @brief Solves A * x = b by the factor of cholesky_factor().
+/// @see cholesky_solve()
+template <std::floating_point T>
+STATUS cholesky_solve(const basic_matrix<T> &l, basic_vector<T> &b) {
+  const size_t n = l.rows(), ld = l.stride();
+  if (l.columns() != n || b.length() != n) return STATUS::BOUND_ARRAY;
+  const T *data = l.data();
+  T *x = b.data();
+  for (size_t i = 0; i < n; i++)
+    x[i] = (x[i] - simd::dot(data + i * ld, x, i)) / data[i * ld + i];
+  for (size_t i = n; i-- > 0;) {
+    x[i] /= data[i * ld + i];
+    simd::axpy(-x[i], data + i * ld, x, i);
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Factors `m` x `n` matrix in place by the Householder reflectors:
+ * A = Q * R, Q = H(0) * ... * H(k - 1), k = min(m, n). The upper triangular
+ * `R` is stored on and above the diagonal, the vector of reflector `j` below
+ * the diagonal of the column `j` with the implicit first element 1.
+ *
+ * @details The reflectors of panel are applied to the panel one by one, then
+ * the block reflector I - V * T * V^T is applied to the rest of matrix by two
+ * products of gemm_strided().
+ *
+ * @param a   Matrix, then its factors
+ * @param tau Factors of reflectors of `min(m, n)` elements
+ * @return `STATUS::BOUND_ARRAY` if `tau` is short, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS qr_factor(basic_matrix<T> &a, basic_vector<T> &tau) {
+  const size_t m = a.rows(), n = a.columns(), ld = a.stride();
+  const size_t steps = std::min(m, n);
+  if (tau.length() < steps) return STATUS::BOUND_ARRAY;
+  T *data = a.data();
+  basic_vector<T> buffer(n, uninitialized);
+
+  for (size_t k = 0; k < steps; k += factor_block) {
+    const size_t kb = std::min(factor_block, steps - k);
+    const size_t next = k + kb;
+    for (size_t j = k; j < next; j++) {
+      tau.data()[j] = detail::householder(a, j);
+      detail::apply_householder(a, j, tau.data()[j], j + 1, next,
+                                buffer.data());
+    }
+    if (next >= n) continue;
+
+    // V of the unit lower trapezoid and the upper triangular T of the block
+    // reflector: T(0:j, j) = -tau_j * T(0:j, 0:j) * V(:, 0:j)^T * v_j
+    const size_t rows = m - k, columns = n - next;
+    basic_matrix<T> v(rows, kb);
+    for (size_t i = 0; i < rows; i++)
+      for (size_t j = 0; j < kb && j <= i; j++)
+        v.set(i, j, i == j ? T(1) : data[(k + i) * ld + k + j]);
+    basic_matrix<T> t(kb, kb);
+    const T *vd = v.data();
+    T *td = t.data();
+    const size_t vs = v.stride(), ts = t.stride();
+    for (size_t j = 0; j < kb; j++) {
+      const T factor = tau.data()[k + j];
+      td[j * ts + j] = factor;
+      for (size_t p = 0; p < j; p++) {
+        T total = 0;
+        for (size_t i = j; i < rows; i++)
+          total += vd[i * vs + p] * vd[i * vs + j];
+        buffer.data()[p] = -factor * total;
+      }
+      for (size_t p = 0; p < j; p++) {
+        T total = 0;
+        for (size_t q = p; q < j; q++)
+          total += td[p * ts + q] * buffer.data()[q];
+        td[p * ts + j] = total;
+      }
+    }
+
+    // A2 = (I - V * T^T * V^T) * A2: W = V^T * A2, W = T^T * W, A2 -= V * W
+    basic_matrix<T> w(kb, columns);
+    T *c = data + k * ld + next;
+    gemm_strided(kb, columns, rows, vd, size_t{1}, vs, c, ld, size_t{1},
+                 w.data(), w.stride());
+    for (size_t i = kb; i-- > 0;) {
+      T *row = w.data() + i * w.stride();
+      simd::mul(row, td[i * ts + i], row, columns);
+      for (size_t p = 0; p < i; p++)
+        simd::axpy(td[p * ts + i], w.data() + p * w.stride(), row, columns);
+    }
+    gemm_strided(rows, columns, kb, vd, vs, size_t{1}, w.data(), w.stride(),
+                 size_t{1}, c, ld, T(-1));
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Solves the least squares problem min |A * x - b| by the factors of
+ * qr_factor() of `m` x `n` matrix, m >= n.
+ *
+ * @param qr  Factors of matrix
+ * @param tau Factors of reflectors
+ * @param b   Right-hand side of `m` elements
+ * @param x   Solution of `n` elements
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, `STATUS::SINGULAR`
+ * if `R` is singular, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS qr_solve(const basic_matrix<T> &qr, const basic_vector<T> &tau,
+                const basic_vector<T> &b, basic_vector<T> &x) {
+  const size_t m = qr.rows(), n = qr.columns(), ld = qr.stride();
+  if (m < n || tau.length() < n || b.length() != m || x.length() != n)
+    return STATUS::BOUND_ARRAY;
+  const T *data = qr.data();
+  for (size_t i = 0; i < n; i++)
+    if (data[i * ld + i] == 0) return STATUS::SINGULAR;
+
+  // y = Q^T * b
+  basic_vector<T> y(b);
+  for (size_t j = 0; j < n; j++) {
+    const T factor = tau.data()[j];
+    if (factor == 0) continue;
+    T total = y.data()[j];
+    for (size_t i = j + 1; i < m; i++) total += data[i * ld + j] * y.data()[i];
+    total *= factor;
+    y.data()[j] -= total;
+    for (size_t i = j + 1; i < m; i++) y.data()[i] -= total * data[i * ld + j];
+  }
+  for (size_t i = n; i-- > 0;)
+    x.data()[i] = (y.data()[i] - simd::dot(data + i * ld + i + 1,
+                                           x.data() + i + 1, n - i - 1)) /
+                  data[i * ld + i];
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Solves A * x = b by LU of the copy of `a`. `b` is replaced by the
+ * solution.
+ *
+ * @param a Square matrix
+ * @param b Right-hand side, then the solution
+ * @return Status of lu_factor() and lu_solve()
+ */
+template <std::floating_point T>
+STATUS solve(const basic_matrix<T> &a, basic_vector<T> &b) {
+  if (a.rows() != a.columns() || b.length() != a.rows())
+    return STATUS::BOUND_ARRAY;
+  basic_matrix<T> lu(a);
+  std::pmr::vector<size_t> pivots(a.rows(), thread_resource());
+  const STATUS status = lu_factor(lu, std::span(pivots));
+  if (status != STATUS::GOOD_ALLOCATOR) return status;
+  return lu_solve(lu, std::span<const size_t>(pivots), b);
+}
+
+/// @brief Solves A * X = B for the columns of `b`. @see solve()
+template <std::floating_point T>
+STATUS solve(const basic_matrix<T> &a, basic_matrix<T> &b) {
+  if (a.rows() != a.columns() || b.rows() != a.rows())
+    return STATUS::BOUND_ARRAY;
+  basic_matrix<T> lu(a);
+  std::pmr::vector<size_t> pivots(a.rows(), thread_resource());
+  const STATUS status = lu_factor(lu, std::span(pivots));
+  if (status != STATUS::GOOD_ALLOCATOR) return status;
+  return lu_solve(lu, std::span<const size_t>(pivots), b);
+}
+
+/**
+ * @brief Inverts the matrix in place by LU. If the matrix is singular, it
+ * isn't changed.
+ *
+ * @param a Square matrix, then its inverse
+ * @return `STATUS::BOUND_ARRAY` if the matrix isn't square,
+ * `STATUS::SINGULAR` if it's singular, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <std::floating_point T>
+STATUS inverse(basic_matrix<T> &a) {
+  const size_t n = a.rows();
+  if (a.columns() != n) return STATUS::BOUND_ARRAY;
+  basic_matrix<T> result(n, n);
+  for (size_t i = 0; i < n; i++) result.set(i, i, T(1));
+  const STATUS status = solve(a, result);
+  if (status == STATUS::GOOD_ALLOCATOR) a = std::move(result);
+  return status;
+}
+
+/**
+ * @brief Calculates the determinant by LU of the copy of matrix. If the
+ * matrix isn't square, returns 0.
+ *
+ * @param a Square matrix
+ * @return Determinant
+ */
+template <std::floating_point T>
+T det(const basic_matrix<T> &a) {
+  const size_t n = a.rows();
+  if (a.columns() != n) return 0;
+  basic_matrix<T> lu(a);
+  std::pmr::vector<size_t> pivots(n, thread_resource());
+  if (lu_factor(lu, std::span(pivots)) != STATUS::GOOD_ALLOCATOR) return 0;
+  T result = 1;
+  for (size_t i = 0; i < n; i++) {
+    result *= lu(i, i);
+    if (pivots[i] != i) result = -result;
+  }
+  return result;
+}
+
+}  // namespace bez
+#endif
@@ -2,7 +2,7 @@
  * @file Matrix.h
  * @brief Implements the functionally for Matrix.
  *
- * @version 0.1.1
+ * @version 0.25
  *
  * @date 15:00 2020-10-09
  * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
@@ -17,97 +17,216 @@
  * * 2020-10-09 V0.1.1 Added documentation.
  * * 2020-10-10 V0.2 Aded overload of `+=`, `-=`, `/`, `/=`, `*=`, `>=`, `<=`.
  * * 2020-10-10 V0.2.1 Added defines _Status with STATUS::DIVIDED_ZERO
+ * * 2026-10-14 V0.3 Stored the elements in one contiguous row-major buffer
+ *   with the leading dimension `_Stride` instead of the array of basic_vector.
+ * * 2026-10-14 V0.4 Added move constructor and move operation `=`.
+ * * 2026-10-14 V0.5 Operations `+`, `-`, `/` return the expressions which are
+ *   computed on assignment. @see basic_expression.h
+ * * 2026-10-14 V0.6 Operations `*`, `*=` use the blocked kernel. @see gemm()
+ * * 2026-10-14 V0.7 The memory is taken from the polymorphic memory resource.
+ *   @see basic_memory.h
+ * * 2026-10-14 V0.8 Added the constructor of uninitialized matrix. The memory
+ *   is aligned to the cache line.
+ * * 2026-10-14 V0.9 basic_matrix<T> is the specialization of the matrix of
+ *   dynamic shape. @see basic_fixed.h
+ * * 2026-10-14 V0.10 Added the views `row()`, `col()`, `block()`,
+ *   `transpose()`. @see basic_view.h
+ * * 2026-10-14 V0.11 Added the constructor of matrix of external memory.
+ *   @see basic_io.h
+ * * 2026-10-14 V0.12 `==` compares the elements without the temporary
+ *   vectors.
+ * * 2026-10-14 V0.13 Copies, temporaries and operations are counted by the
+ *   statistics. @see basic_stats.h
+ * * 2026-10-14 V0.14 The product of rectangular matrices checks the shapes
+ *   and is always computed by the blocked kernel. The views, e.g. the
+ *   transposed matrices, are multiplied without copying.
+ * * 2026-10-14 V0.15 The product of sparse matrix and matrix sets the status.
+ *   @see basic_sparse.h
+ * * 2026-10-14 V0.16 Added `transpose_in_place()` and `transpose()` of the
+ *   copy, which are computed by the tiles. @see basic_transpose.h
+ * * 2026-10-14 V0.17 `sum()` accumulates in `accumulator_t`. The products of
+ *   reduced precision are accumulated in the wider type. @see gemm_strided()
+ * * 2026-10-14 V0.18 `sum()` is public and takes the strategy of summation.
+ *   Added `row_sums()` and `column_sums()`. @see basic_reduce.h
+ * * 2026-10-14 V0.19 Added the minima, the maxima, the means and the norms
+ *   of rows and columns, and the broadcast `add_rows()`, `mul_rows()`,
+ *   `add_columns()`, `mul_columns()` of vectors.
+ * * 2026-10-14 V0.20 `at()` doesn't check the indexes like `at()` of
+ *   basic_vector, `()` checks them only if `BEZ_CHECKED`.
+ * * 2026-10-14 V0.21 Declared the plan of deferred graph. @see basic_graph.h
+ * * 2026-10-14 V0.22 The products of large matrices are computed by the
+ *   Strassen-Winograd algorithm, if it's turned on. @see basic_strassen.h
+ * * 2026-10-14 V0.23 `=`, `+=` and `-=` of the expressions, which read this
+ *   matrix by another layout, compute them into the temporary.
+ * * 2026-10-14 V0.24 `m = m.transpose()` of rectangular matrix is transposed
+ *   in place instead of reading the freed memory.
+ * * 2026-10-14 V0.25 `/=` divides the rows in parallel by the vectorized
+ *   kernel like `/` of vectors.
  */
 
 #pragma once
 #ifndef BASIC_MATRIX
 #define BASIC_MATRIX
 
+#include "basic_gemm.h"
+#include "basic_memory.h"
+#include "basic_reduce.h"
+#include "basic_simd.h"
+#include "basic_strassen.h"
+#include "basic_transpose.h"
 #include "basic_vector.h"
+#include "basic_view.h"
 
 namespace bez {
 
+namespace detail {
+
+template <typename T>
+basic_matrix<T> multiply(matrix_view<const T> lhs, matrix_view<const T> rhs);
+
+template <typename T>
+class graph_plan;
+
+}  // namespace detail
+
 /**
  * @class Matrix Matrix.h
  *
  * @brief Functionally implements of Matrix. It's implemented on allocating
- * dynamic memory for the array of basic_vector. If an error occurs, determines
- * to
- * `_Status`. @see _Status @see basic_vector
+ * one contiguous block of dynamic memory of `rows * columns` elements in
+ * row-major order. If an error occurs, determines to `_Status`.
+ * @see _Status @see basic_vector
  *
- * @ingroup Dynamic array of basic_vector
+ * @ingroup Dynamic array
  *
- * @details Defined the error status such as basic_vector.
+ * @details Defined the error status such as basic_vector. The element
+ * (row, column) is stored at `_Allocator[row * _Stride + column]`, where
+ * `_Stride` is the leading dimension of the matrix (`_Stride >= _Columns`).
+ * The memory is taken from the memory resource such as basic_vector.
  *
  * @exception Undefined behavior for char. No exception for overload _Status.
  *
  * @tparam T Integral or float point number
  */
 template <typename T>
-class basic_matrix {
+class basic_matrix<T, dynamic_extent, dynamic_extent> {
  private:
-  size_t _Rows;                 // Rows of Matrix
-  size_t _Columns;              // Columns of Matrix
-  basic_vector<T> *_Allocator;  // Allocator memory for basic_vector
+  size_t _Rows;            // Rows of Matrix
+  size_t _Columns;         // Columns of Matrix
+  size_t _Stride;          // Leading dimension (distance between rows)
+  T *_Allocator{nullptr};  // Allocated memory of `_Rows * _Stride` elements
+  std::pmr::memory_resource *_Resource;  // Source of memory
 
  public:
+  using value_type = T;
+
   /// @brief Initialize Matrix 5x5 to zero
-  basic_matrix() : _Rows(5), _Columns(5) {
-    _Allocator = new basic_vector<T>[5];
-    if (_Allocator == nullptr)
-      STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t row = 0; row < 5; row++) _Allocator[row] = basic_vector<T>(5);
-  }
+  basic_matrix() : basic_matrix(5, 5) {}
 
   /**
    * @brief Initialize Matrix `size` x `size` to zero.
    *
    * @param size Size of matrix
    */
-  basic_matrix(size_t size) : _Rows(size), _Columns(size) {
-    _Allocator = new basic_vector<T>[size];
-    if (_Allocator == nullptr)
-      STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t row = 0; row < _Rows; row++)
-        _Allocator[row] = basic_vector<T>(size);
-  }
+  basic_matrix(size_t size) : basic_matrix(size, size) {}
 
   /**
    * @brief Initialize matrix `rows` x `columns` to `value`.
    *
+   * @param rows     Rows of matrix
+   * @param columns  Columsn of matrix
+   * @param value    Value to initialize
+   * @param resource Source of memory. @see thread_resource()
+   */
+  basic_matrix(size_t rows, size_t columns, T value = 0,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    if (allocate(rows, columns))
+      std::fill(_Allocator, _Allocator + _Rows * _Stride, value);
+  }
+
+  /**
+   * @brief Initialize matrix `rows` x `columns` without initializing the
+   * elements. @see uninitialized_t
+   *
+   * @param rows     Rows of matrix
+   * @param columns  Columns of matrix
+   * @param resource Source of memory
+   */
+  basic_matrix(size_t rows, size_t columns, uninitialized_t,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    allocate(rows, columns);
+  }
+
+  /**
+   * @brief Refers to `rows` x `columns` elements of the external memory in
+   * row-major order without copying. @see external_t
+   *
+   * @param data    Elements of matrix
    * @param rows    Rows of matrix
-   * @param columns Columsn of matrix
-   * @param value   Value to initialize
+   * @param columns Columns of matrix
+   * @param stride  Leading dimension, `stride >= columns`
    */
-  basic_matrix(size_t rows, size_t columns, T value = 0)
-      : _Rows(rows), _Columns(columns) {
-    _Allocator = new basic_vector<T>[_Rows];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t row = 0; row < rows; row++)
-        _Allocator[row] = basic_vector<T>(columns, value);
+  basic_matrix(T *data, size_t rows, size_t columns, size_t stride, external_t)
+      : _Rows(rows),
+        _Columns(columns),
+        _Stride(stride),
+        _Allocator(data),
+        _Resource(std::pmr::null_memory_resource()) {}
+
+  /**
+   * @brief Copy constructor. The memory is taken from the `resource`, not from
+   * the resource of the `other`.
+   *
+   * @param other    Initialized Matrix
+   * @param resource Source of memory
+   */
+  basic_matrix(const basic_matrix<T> &other,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    _Status = other._Status;
+    BEZ_STATS_COPY();
+    if (allocate(other._Rows, other._Columns)) copy(other);
   }
 
-  /// @brief Copy constructor.
-  /// @param other Initialized Matrix
-  basic_matrix(const basic_matrix<T> &other) {
+  /**
+   * @brief Move constructor. Takes the memory and the resource of the `other`,
+   * which is left empty with the shape 0x0.
+   *
+   * @param other Initialized Matrix
+   */
+  basic_matrix(basic_matrix<T> &&other) noexcept
+      : _Rows(std::exchange(other._Rows, 0)),
+        _Columns(std::exchange(other._Columns, 0)),
+        _Stride(std::exchange(other._Stride, 0)),
+        _Allocator(std::exchange(other._Allocator, nullptr)),
+        _Resource(other._Resource) {
     _Status = other._Status;
-    _Rows = other.rows();
-    _Allocator = new basic_vector<T>[_Rows];
-    if (_Allocator == nullptr)
+  }
+
+  /**
+   * @brief Computes the expression of matrices with one loop. Takes the status
+   * of the expression. @see basic_expression.h
+   *
+   * @param expression Node of expression
+   * @param resource   Source of memory
+   */
+  template <matrix_operand E>
+    requires(!detail::is_basic_matrix<E>::value &&
+             std::same_as<typename E::value_type, T>)
+  basic_matrix(const E &expression,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    _Status = expression.status();
+    BEZ_STATS_TEMPORARY();
+    if (allocate(expression.rows(), expression.columns()) &&
+        !detail::evaluate(_Allocator, _Stride, expression, detail::assign))
       _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t row = 0; row < _Rows; row++)
-        _Allocator[row] = other._Allocator[row];
   }
 
   /// @brief Free the allocated dynamic memory, if it is allocated.
-  ~basic_matrix() {
-    if (_Allocator != nullptr) delete[] _Allocator;
-  }
+  ~basic_matrix() { release(); }
 
   /**
    * @brief Overload operation `=`. If it is self-assignment, retuns this.
@@ -119,25 +238,84 @@ class basic_matrix {
     if (this == &other) return *this;
 
     _Status = other._Status;
+    BEZ_STATS_COPY();
 
-    if (_Allocator != nullptr) delete[] _Allocator;
+    // Reuses the memory, if the shape is the same
+    if (_Rows != other._Rows || _Columns != other._Columns) {
+      release();
+      if (!allocate(other._Rows, other._Columns)) return *this;
+    }
+    copy(other);
 
-    _Rows = other._Rows;
-    _Columns = other._Columns;
-    _Allocator = new basic_vector<T>[_Rows];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t row = 0; row < _Rows; row++)
-        _Allocator[row] = other._Allocator[row];
+    return *this;
+  }
+
+  /**
+   * @brief Overload operation `=` like move. Frees the own memory and takes the
+   * memory of the `other`. If it is self-assignment, retuns this. If the
+   * resources aren't equal, copies the elements to the own memory, since the
+   * matrix keeps its resource.
+   *
+   * @param other Initialized Matrix
+   * @return Matrix
+   */
+  basic_matrix<T> &operator=(basic_matrix<T> &&other) noexcept {
+    if (this == &other) return *this;
+
+    if (!_Resource->is_equal(*other._Resource)) return *this = other;
+
+    release();
+
+    _Status = other._Status;
+    _Rows = std::exchange(other._Rows, 0);
+    _Columns = std::exchange(other._Columns, 0);
+    _Stride = std::exchange(other._Stride, 0);
+    _Allocator = std::exchange(other._Allocator, nullptr);
+    return *this;
+  }
 
+  /**
+   * @brief Overload operation `=` for the expression of matrices. Computes the
+   * expression with one loop and takes its status. The expression may read
+   * this matrix, e.g. `m = m.transpose()`: the own transposed view is
+   * transposed in place, other expressions of another layout are computed
+   * into the temporary. @see basic_expression.h
+   *
+   * @param expression Node of expression
+   * @return Matrix
+   */
+  template <matrix_operand E>
+    requires(!detail::is_basic_matrix<E>::value &&
+             std::same_as<typename E::value_type, T>)
+  basic_matrix<T> &operator=(const E &expression) {
+    // The expression of another shape may refer to this memory, e.g. the
+    // transposed view, so it's computed before the memory is freed
+    if (_Rows != expression.rows() || _Columns != expression.columns()) {
+      if constexpr (requires { expression.column_stride(); })
+        if (expression.data() == _Allocator && expression.row_stride() == 1 &&
+            expression.column_stride() == _Stride &&
+            expression.rows() == _Columns &&
+            expression.columns() == _Rows) {
+          transpose_in_place();
+          _Status = expression.status();
+          return *this;
+        }
+      return *this = basic_matrix<T>(expression, _Resource);
+    }
+
+    _Status = expression.status();
+    if (!detail::evaluate(_Allocator, _Stride, expression, detail::assign))
+      _Status = STATUS::BAD_ALLOCATOR;
     return *this;
   }
 
   friend std::ostream &operator<<(std::ostream &os,
                                   const basic_matrix<T> &obj) {
-    for (size_t i = 0; i < obj.rows(); i++)
-      os << obj._Allocator[i] << std::endl;
+    for (size_t row = 0; row < obj.rows(); row++) {
+      const T *line = obj._Allocator + row * obj._Stride;
+      for (size_t col = 0; col < obj.columns(); col++) os << line[col] << ' ';
+      os << std::endl;
+    }
     return os;
   }
 
@@ -149,37 +327,35 @@ class basic_matrix {
    * @param value   Value to initialize
    */
   void set(const size_t row, const size_t column, const T value = 0) {
-    _Allocator[row][column] = value;
+    _Allocator[row * _Stride + column] = value;
   }
 
   /**
-   * @brief Get the element
+   * @brief Get the element without checking the indexes.
    *
    * @param row     Index of row
    * @param column  Index of column
    * @return        r-value of element
    */
   constexpr const T &at(const size_t row, const size_t column) const {
-    if (row >= 0 && row < _Rows) return _Allocator[row][column];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Rows - 1][_Columns - 1];
+    return _Allocator[row * _Stride + column];
   }
 
   /**
-   * @brief Set the element like r-value.
+   * @brief Set the element like r-value without checking the indexes.
    *
    * @param row     Index of row
    * @param column  Index of column
    * @return l-value of element
    */
   constexpr T &at(const size_t row, const size_t column) {
-    if (row >= 0 && row < _Rows) return _Allocator[row][column];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Rows - 1][_Columns - 1];
+    return _Allocator[row * _Stride + column];
   }
 
   /**
-   * @brrief Overload operation `()` like matrix access [][].
+   * @brrief Overload operation `()` like matrix access [][]. If the indexes
+   * go beyond the matrix, returns the last element with the error status
+   * `STATUS::BOUND_ARRAY`. With `BEZ_CHECKED=0` it's the same as `at()`.
    *
    * @exception Implement in basic_stream @see basic_stream
    *
@@ -188,13 +364,15 @@ class basic_matrix {
    * @return l-value of element
    */
   constexpr T &operator()(const size_t row, const size_t column) {
-    if (row >= 0 && row < _Rows) return _Allocator[row][column];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Rows - 1][_Columns - 1];
+    if (BEZ_CHECKED && (row >= _Rows || column >= _Columns)) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Allocator[(_Rows - 1) * _Stride + _Columns - 1];
+    }
+    return _Allocator[row * _Stride + column];
   }
 
   /**
-   * @brrief Overload operation `()` like matrix access [][].
+   * @brrief Overload operation `()` like matrix access [][]. @see operator()()
    *
    * @exception Implement in basic_stream @see basic_stream
    *
@@ -203,145 +381,97 @@ class basic_matrix {
    * @return r-value of element
    */
   constexpr const T &operator()(const size_t row, const size_t column) const {
-    if (row >= 0 && row < _Rows) return _Allocator[row][column];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Rows - 1][_Columns - 1];
-  }
-
-  /// @brief Overload `+`.
-  friend basic_matrix<T> operator+(const basic_matrix<T> &lhs,
-                                   const basic_matrix<T> &rhs) {
-    basic_matrix<T> matrix(lhs);
-    if ((lhs._Rows != rhs._Rows) && (lhs._Columns != rhs._Columns)) {
-      matrix._Status = STATUS::BOUND_ARRAY;
-      return matrix;
-    }
-
-    for (size_t i = 0; i < lhs._Rows; i++)
-      matrix._Allocator[i] = (lhs._Allocator[i] + rhs._Allocator[i]);
-
-    return matrix;
-  }
-
-  /// @brief Overload `-`.
-  friend basic_matrix<T> operator-(const basic_matrix<T> &lhs,
-                                   const basic_matrix<T> &rhs) {
-    basic_matrix<T> matrix(lhs);
-    if ((lhs._Rows != rhs._Rows) && (lhs._Columns != rhs._Columns)) {
-      matrix._Status = STATUS::BOUND_ARRAY;
-      return matrix;
+    if (BEZ_CHECKED && (row >= _Rows || column >= _Columns)) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Allocator[(_Rows - 1) * _Stride + _Columns - 1];
     }
-
-    for (size_t i = 0; i < lhs._Rows; i++)
-      matrix._Allocator[i] = (lhs._Allocator[i] - rhs._Allocator[i]);
-
-    return matrix;
+    return _Allocator[row * _Stride + column];
   }
 
   /**
-   * @brief Return the product of Matrix. The size must be matching size.
-   * Otherwise return Matrix with one element of zero.
+   * @brief Return the product of `m` x `k` matrix and `k` x `n` matrix, which
+   * is computed by the blocked kernel. If the columns of `lhs` aren't equal
+   * to the rows of `rhs`, returns the matrix with one element of zero and the
+   * error status `STATUS::BOUND_ARRAY`. @see gemm()
+   *
+   * @details The transposed operands aren't copied: `a.transpose() * b` and
+   * `a * b.transpose()` multiply the views by their strides.
    *
    * @param lhs First matrix
-   * @param rhs First matrix
+   * @param rhs Last matrix
    * @return Product of Matrix
    */
   friend basic_matrix<T> operator*(const basic_matrix<T> &lhs,
                                    const basic_matrix<T> &rhs) {
-    if (lhs._Rows != rhs._Columns && lhs._Columns != rhs._Rows)
-      return basic_matrix<T>{1, 1};
-
-    size_t rows, columns;
-    if (lhs._Rows >= rhs._Columns) {
-      rows = lhs._Rows;
-      columns = rhs._Columns;
-    } else {
-      rows = lhs._Columns;
-      columns = rhs._Rows;
-    }
+    return detail::multiply<T>(lhs.view(), rhs.view());
+  }
 
-    basic_matrix<T> matrix(rows, columns);
+  friend basic_matrix<T> detail::multiply<T>(matrix_view<const T> lhs,
+                                             matrix_view<const T> rhs);
 
-    for (size_t row = 0; row < rows; row++)
-      for (size_t col = 0; col < columns; col++)
-        for (size_t inner = 0; inner < rows; inner++)
-          matrix(row, col) += lhs(row, inner) * rhs(inner, col);
+  template <number U, sparse_format F>
+  friend class basic_sparse_matrix;
 
-    return matrix;
-  }
+  friend class detail::graph_plan<T>;
 
   /**
-   * @brief Overload `/`.
+   * @brief Overload `+=`. If the shapes are different, returns this. The
+   * expression is computed in the same loop. The expression, which reads this
+   * matrix by another layout, e.g. `m += m.transpose()`, is computed into the
+   * temporary. @see basic_expression.h
    *
-   * @param other Matrix
-   * @param k
-   * @return Matrix
+   * @param other Matrix or expression of matrices
+   * @return Sum of matrices
    */
-  friend basic_matrix<T> operator/(const basic_matrix<T> &other, const T k) {
-    basic_matrix<T> matrix(other);
-
-    if (k == 0) {
-      matrix._Status = STATUS::DIVIDED_ZERO;
-      return matrix;
-    }
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type, T>
+  basic_matrix<T> &operator+=(const E &other) {
+    if (_Rows != other.rows() || _Columns != other.columns()) return *this;
 
-    for (size_t i = 0; i < other.size(); i++) {
-      matrix._Allocator[i] = (other._Allocator[i] / k);
-    }
-
-    return matrix;
-  }
-
-  /// @brief Overload `+=`.
-  basic_matrix<T> &operator+=(const basic_matrix<T> &other) {
-    if (_Rows != other.rows() && _Columns != other.columns()) return *this;
-
-    for (size_t i = 0; i < _Rows; i++) _Allocator[i] += other._Allocator[i];
+    if (!detail::evaluate(_Allocator, _Stride, detail::as_matrix_node(other),
+                          detail::plus_assign))
+      _Status = STATUS::BAD_ALLOCATOR;
     return *this;
   }
 
-  /// @brief Overload `-=`.
-  basic_matrix<T> &operator-=(const basic_matrix<T> &other) {
-    if (_Rows != other.rows() && _Columns != other.columns()) return *this;
+  /// @brief Overload `-=`. @see operator+=()
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type, T>
+  basic_matrix<T> &operator-=(const E &other) {
+    if (_Rows != other.rows() || _Columns != other.columns()) return *this;
 
-    for (size_t i = 0; i < _Rows; i++) _Allocator[i] -= other._Allocator[i];
+    if (!detail::evaluate(_Allocator, _Stride, detail::as_matrix_node(other),
+                          detail::minus_assign))
+      _Status = STATUS::BAD_ALLOCATOR;
     return *this;
   }
 
+  /// @brief Overload `/=`. If k = 0, returns this with STATUS::DIVIDED_ZERO.
+  /// The rows are divided in parallel. @see operator/=() of basic_vector
   basic_matrix<T> &operator/=(const T k) {
     if (k == 0) {
       _Status = STATUS::DIVIDED_ZERO;
       return *this;
     }
-
-    for (size_t i = 0; i < _Rows; i++) {
-      _Allocator[i] /= k;
-    }
-
+    BEZ_STATS_OPERATION(scale, _Rows * _Columns, _Rows * _Columns);
+    detail::for_each_row(_Allocator, _Stride, _Rows, _Columns,
+                         [&](T *line, size_t) {
+                           simd::div(line, k, line, _Columns);
+                         });
     return *this;
   }
 
-  /// @brief Overload `*=`.
+  /**
+   * @brief Overload `*=`. If the columns of this aren't equal to the rows of
+   * `other`, this isn't changed and takes the error status
+   * `STATUS::BOUND_ARRAY`. @see operator*()
+   */
   basic_matrix<T> &operator*=(const basic_matrix<T> &other) {
-    if (_Rows != other._Columns && _Columns != other._Rows) return *this;
-
-    size_t rows, columns;
-    if (_Rows >= other._Columns) {
-      rows = _Rows;
-      columns = other._Columns;
-    } else {
-      rows = _Columns;
-      columns = other._Rows;
+    if (_Columns != other._Rows) {
+      _Status = STATUS::BOUND_ARRAY;
+      return *this;
     }
-
-    basic_matrix<T> matrix(rows, columns);
-
-    for (size_t row = 0; row < rows; row++)
-      for (size_t col = 0; col < columns; col++)
-        for (size_t inner = 0; inner < rows; inner++)
-          matrix(row, col) += this->operator()(row, inner) * other(inner, col);
-
-    *this = matrix;
+    *this = *this * other;
     return *this;
   }
 
@@ -349,7 +479,7 @@ class basic_matrix {
   STATUS status() const { return _Status; }
 
   /// @brief Get the name of error status
-  const std::string to_string_status() { _Allocator->to_string_status(); }
+  const std::string to_string_status() { return to_string(_Status); }
 
   /**
    * @brief Get the rows.
@@ -365,14 +495,303 @@ class basic_matrix {
    */
   constexpr size_t columns() const { return _Columns; }
 
-  /// @brief Implement like in basic_vector @see basic_vector
+  /**
+   * @brief Get the leading dimension, i.e. the distance in elements between
+   * the beginnings of two neighboring rows.
+   *
+   * @return Leading dimension
+   */
+  constexpr size_t stride() const { return _Stride; }
+
+  /**
+   * @brief Get the pointer to the elements of matrix. The element (row, column)
+   * is `data()[row * stride() + column]`.
+   *
+   * @return Pointer to the first element
+   */
+  constexpr T *data() { return _Allocator; }
+
+  /// @see constexpr T *data();
+  constexpr const T *data() const { return _Allocator; }
+
+  /// @brief Get the resource which the memory of matrix is taken from.
+  std::pmr::memory_resource *resource() const { return _Resource; }
+
+  /// @brief Get the view of all elements. @see matrix_view
+  matrix_view<T> view() {
+    return matrix_view<T>(_Allocator, _Rows, _Columns, _Stride);
+  }
+
+  /// @see matrix_view<T> view();
+  matrix_view<const T> view() const {
+    return matrix_view<const T>(_Allocator, _Rows, _Columns, _Stride);
+  }
+
+  /**
+   * @brief Get the view of row without copying. If the index goes beyond the
+   * matrix, returns the empty view with the error status
+   * `STATUS::BOUND_ARRAY`.
+   *
+   * @param row Index of row
+   * @return View of row
+   */
+  vector_view<T> row(size_t row) { return checked(view().row(row)); }
+
+  /// @see vector_view<T> row(size_t row);
+  vector_view<const T> row(size_t row) const {
+    return checked(view().row(row));
+  }
+
+  /// @brief Get the view of column. @see row()
+  vector_view<T> col(size_t column) { return checked(view().col(column)); }
+
+  /// @see vector_view<T> col(size_t column);
+  vector_view<const T> col(size_t column) const {
+    return checked(view().col(column));
+  }
+
+  /**
+   * @brief Get the view of block `rows` x `columns` from the element (`row`,
+   * `column`) without copying. @see matrix_view::block()
+   *
+   * @param row     Index of first row
+   * @param column  Index of first column
+   * @param rows    Rows of block
+   * @param columns Columns of block
+   * @return View of block
+   */
+  matrix_view<T> block(size_t row, size_t column, size_t rows,
+                       size_t columns) {
+    return checked(view().block(row, column, rows, columns));
+  }
+
+  /// @see matrix_view<T> block(size_t, size_t, size_t, size_t);
+  matrix_view<const T> block(size_t row, size_t column, size_t rows,
+                             size_t columns) const {
+    return checked(view().block(row, column, rows, columns));
+  }
+
+  /**
+   * @brief Get the view of transposed matrix without moving the elements.
+   * The copy `basic_matrix<T>(matrix.transpose())` is computed by the tiles,
+   * `m = m.transpose()` calls `transpose_in_place()`. @see basic_transpose.h
+   *
+   * @return View of transposed matrix
+   */
+  matrix_view<T> transpose() { return view().transpose(); }
+
+  /// @see matrix_view<T> transpose();
+  matrix_view<const T> transpose() const { return view().transpose(); }
+
+  /**
+   * @brief Transposes the matrix in the same memory. The square matrix swaps
+   * the tiles, the rectangular matrix is moved by the cycles of permutation
+   * with `rows() * columns()` bits of memory. The rectangular matrix of the
+   * external memory with `stride() > columns()` becomes contiguous.
+   *
+   * @return Transposed matrix
+   */
+  basic_matrix<T> &transpose_in_place() {
+    if (_Rows == _Columns) {
+      detail::transpose_square(_Allocator, _Stride, _Rows);
+      return *this;
+    }
+    for (size_t row = 1; _Stride != _Columns && row < _Rows; row++)
+      std::copy(_Allocator + row * _Stride,
+                _Allocator + row * _Stride + _Columns,
+                _Allocator + row * _Columns);
+    detail::transpose_cycles(_Allocator, _Rows, _Columns);
+    std::swap(_Rows, _Columns);
+    _Stride = _Columns;
+    return *this;
+  }
+
+  /**
+   * @brief Calculates the sum of all elements of the matrix. The numbers of
+   * reduced precision are summed in `accumulator_t<T>`.
+   *
+   * @param mode Strategy of summation. @see summation
+   * @return Sum of elements
+   */
+  accumulator_t<T> sum(summation mode = summation::fast) const {
+    BEZ_STATS_OPERATION(sum, _Rows * _Columns, _Rows * _Columns);
+    return detail::matrix_sum(_Allocator, _Stride, _Rows, _Columns, mode);
+  }
+
+  /**
+   * @brief Calculates the sums of rows in one pass over the matrix.
+   *
+   * @param mode Strategy of summation. @see summation
+   * @return Vector of `rows()` sums
+   */
+  basic_vector<accumulator_t<T>> row_sums(
+      summation mode = summation::fast) const {
+    BEZ_STATS_OPERATION(sum, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<accumulator_t<T>> result(_Rows, uninitialized);
+    detail::row_sums(_Allocator, _Stride, _Rows, _Columns, result.data(),
+                     mode);
+    return result;
+  }
+
+  /**
+   * @brief Calculates the sums of columns in one pass over the matrix. The
+   * blocks of columns are accumulated row by row, so the temporary columns
+   * aren't made.
+   *
+   * @param mode Strategy of summation. @see summation
+   * @return Vector of `columns()` sums
+   */
+  basic_vector<accumulator_t<T>> column_sums(
+      summation mode = summation::fast) const {
+    BEZ_STATS_OPERATION(sum, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<accumulator_t<T>> result(_Columns, uninitialized);
+    detail::column_sums(_Allocator, _Stride, _Rows, _Columns, result.data(),
+                        mode);
+    return result;
+  }
+
+  /**
+   * @brief Calculates the minima of rows. If the matrix has rows without the
+   * columns, it returns zeros with the error status `STATUS::BOUND_ARRAY`.
+   *
+   * @return Vector of `rows()` minima
+   */
+  basic_vector<T> row_minima() const { return row_extrema<false>(); }
+
+  /// @brief Calculates the maxima of rows. @see row_minima()
+  basic_vector<T> row_maxima() const { return row_extrema<true>(); }
+
+  /**
+   * @brief Calculates the minima of columns in one pass over the matrix. If
+   * the matrix has columns without the rows, it returns zeros with the error
+   * status `STATUS::BOUND_ARRAY`.
+   *
+   * @return Vector of `columns()` minima
+   */
+  basic_vector<T> column_minima() const { return column_extrema<false>(); }
+
+  /// @brief Calculates the maxima of columns. @see column_minima()
+  basic_vector<T> column_maxima() const { return column_extrema<true>(); }
+
+  /**
+   * @brief Calculates the means of rows in `real_t<T>`. If the matrix has
+   * rows without the columns, it returns zeros with the error status
+   * `STATUS::BOUND_ARRAY`.
+   *
+   * @param mode Strategy of summation. @see summation
+   * @return Vector of `rows()` means
+   */
+  basic_vector<real_t<T>> row_means(summation mode = summation::fast) const {
+    if (_Rows > 0 && _Columns == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return basic_vector<real_t<T>>(_Rows);
+    }
+    BEZ_STATS_OPERATION(sum, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<real_t<T>> result(_Rows, uninitialized);
+    detail::row_means(_Allocator, _Stride, _Rows, _Columns, result.data(),
+                      mode);
+    return result;
+  }
+
+  /// @brief Calculates the means of columns in one pass over the matrix.
+  /// @see row_means()
+  basic_vector<real_t<T>> column_means(
+      summation mode = summation::fast) const {
+    if (_Columns > 0 && _Rows == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return basic_vector<real_t<T>>(_Columns);
+    }
+    BEZ_STATS_OPERATION(sum, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<real_t<T>> result(_Columns, uninitialized);
+    detail::column_means(_Allocator, _Stride, _Rows, _Columns, result.data(),
+                         mode);
+    return result;
+  }
+
+  /**
+   * @brief Calculates the Euclidean norms of rows in `real_t<T>`.
+   *
+   * @return Vector of `rows()` norms
+   */
+  basic_vector<real_t<T>> row_norms() const {
+    BEZ_STATS_OPERATION(dot, _Rows * _Columns, 2 * _Rows * _Columns);
+    basic_vector<real_t<T>> result(_Rows, uninitialized);
+    detail::row_norms(_Allocator, _Stride, _Rows, _Columns, result.data());
+    return result;
+  }
+
+  /// @brief Calculates the Euclidean norms of columns in one pass over the
+  /// matrix. @see row_norms()
+  basic_vector<real_t<T>> column_norms() const {
+    BEZ_STATS_OPERATION(dot, _Rows * _Columns, 2 * _Rows * _Columns);
+    basic_vector<real_t<T>> result(_Columns, uninitialized);
+    detail::column_norms(_Allocator, _Stride, _Rows, _Columns, result.data());
+    return result;
+  }
+
+  /**
+   * @brief Adds `vector` to every row: (i, j) += vector[j]. If the length of
+   * vector isn't equal to the columns, this isn't changed and takes the error
+   * status `STATUS::BOUND_ARRAY`.
+   *
+   * @param vector Vector of `columns()` elements
+   * @return This matrix
+   */
+  basic_matrix<T> &add_rows(const basic_vector<T> &vector) {
+    return broadcast(vector, _Columns, [&](T *line, size_t) {
+      simd::add(line, vector.data(), line, _Columns);
+    });
+  }
+
+  /// @brief Multiplies every row by `vector`: (i, j) *= vector[j].
+  /// @see add_rows()
+  basic_matrix<T> &mul_rows(const basic_vector<T> &vector) {
+    return broadcast(vector, _Columns, [&](T *line, size_t) {
+      simd::mul(line, vector.data(), line, _Columns);
+    });
+  }
+
+  /**
+   * @brief Adds `vector` to every column: (i, j) += vector[i]. If the length
+   * of vector isn't equal to the rows, this isn't changed and takes the error
+   * status `STATUS::BOUND_ARRAY`.
+   *
+   * @param vector Vector of `rows()` elements
+   * @return This matrix
+   */
+  basic_matrix<T> &add_columns(const basic_vector<T> &vector) {
+    return broadcast(vector, _Rows, [&](T *line, size_t row) {
+      simd::add(line, vector.data()[row], line, _Columns);
+    });
+  }
+
+  /// @brief Multiplies every column by `vector`: (i, j) *= vector[i].
+  /// @see add_columns()
+  basic_matrix<T> &mul_columns(const basic_vector<T> &vector) {
+    return broadcast(vector, _Rows, [&](T *line, size_t row) {
+      simd::mul(line, vector.data()[row], line, _Columns);
+    });
+  }
+
+  /**
+   * @brief If the shapes are different, it returns false. Otherwise compares
+   * the rows like basic_vector without the temporary vectors and stops on the
+   * first different element. @see basic_vector
+   *
+   * @param lhs First matrix
+   * @param rhs Last matrix
+   * @return Equality of matrices
+   */
   friend bool operator==(const basic_matrix<T> &lhs,
                          const basic_matrix<T> &rhs) {
-    if ((lhs._Rows != rhs._Rows) && (lhs._Columns != rhs._Columns))
-      return false;
+    if (!lhs.same_shape(rhs)) return false;
 
-    for (size_t row = 0; row < lhs.rows(); row++)
-      if (lhs._Allocator[row] != rhs._Allocator[row]) return false;
+    BEZ_STATS_OPERATION(equal, lhs._Rows * lhs._Columns,
+                        lhs._Rows * lhs._Columns);
+    for (size_t row = 0; row < lhs._Rows; row++)
+      if (!simd::equal(lhs._Allocator + row * lhs._Stride,
+                       rhs._Allocator + row * rhs._Stride, lhs._Columns))
+        return false;
 
     return true;
   }
@@ -392,15 +811,7 @@ class basic_matrix {
    */
   friend bool operator<(const basic_matrix<T> &lhs,
                         const basic_matrix<T> &rhs) {
-    T sum1 = 0;
-    T sum2 = 0;
-
-    for (size_t row1 = 0; row1 < lhs.rows(); row1++)
-      sum1 += lhs._Allocator[row1].sum();
-    for (size_t row2 = 0; row2 < rhs.rows(); row2++)
-      sum2 += rhs._Allocator[row2].sum();
-
-    return sum1 < sum2;
+    return lhs.sum() < rhs.sum();
   }
 
   friend bool operator>(const basic_matrix<T> &lhs,
@@ -419,7 +830,267 @@ class basic_matrix {
   }
 
  private:
+  /**
+   * @brief Allocates memory for `rows` x `columns` matrix with `_Stride` equal
+   * to `columns`. The elements aren't initialized.
+   *
+   * @param rows    Rows of matrix
+   * @param columns Columns of matrix
+   * @return Is the memory allocated
+   */
+  bool allocate(size_t rows, size_t columns) noexcept {
+    _Rows = rows;
+    _Columns = columns;
+    _Stride = columns;
+    _Allocator = detail::allocate_elements<T>(_Resource, rows * columns);
+    if (_Allocator == nullptr) {
+      _Rows = _Columns = _Stride = 0;
+      _Status = STATUS::BAD_ALLOCATOR;
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Frees the allocated memory, if it is allocated.
+  void release() noexcept {
+    detail::deallocate_elements(_Resource, _Allocator, _Rows * _Stride);
+    _Allocator = nullptr;
+  }
+
+  /// @brief Copies the elements of the matrix of the same shape.
+  void copy(const basic_matrix<T> &other) {
+    for (size_t row = 0; row < _Rows; row++)
+      std::copy(other._Allocator + row * other._Stride,
+                other._Allocator + row * other._Stride + _Columns,
+                _Allocator + row * _Stride);
+  }
+
+  /// @brief Minima or maxima of rows. @see row_minima()
+  template <bool Max>
+  basic_vector<T> row_extrema() const {
+    if (_Rows > 0 && _Columns == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return basic_vector<T>(_Rows);
+    }
+    BEZ_STATS_OPERATION(min, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<T> result(_Rows, uninitialized);
+    detail::row_reduce(_Allocator, _Stride, _Rows, _Columns, result.data(),
+                       [](const T *row, size_t n) {
+                         return Max ? simd::max(row, n) : simd::min(row, n);
+                       });
+    return result;
+  }
+
+  /// @brief Minima or maxima of columns. @see column_minima()
+  template <bool Max>
+  basic_vector<T> column_extrema() const {
+    if (_Columns > 0 && _Rows == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return basic_vector<T>(_Columns);
+    }
+    BEZ_STATS_OPERATION(min, _Rows * _Columns, _Rows * _Columns);
+    basic_vector<T> result(_Columns, uninitialized);
+    if (_Rows > 0)
+      detail::column_extrema<Max>(_Allocator, _Stride, _Rows, _Columns,
+                                  result.data());
+    return result;
+  }
+
+  /// @brief Calls `f(row, index)` for the rows in parallel, if `vector` has
+  /// `length` elements. @see add_rows()
+  template <typename F>
+  basic_matrix<T> &broadcast(const basic_vector<T> &vector, size_t length,
+                             F f) {
+    if (vector.length() != length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return *this;
+    }
+    BEZ_STATS_OPERATION(expression, _Rows * _Columns, _Rows * _Columns);
+    detail::for_each_row(_Allocator, _Stride, _Rows, _Columns, f);
+    return *this;
+  }
+
+  /// @brief Takes the error status of the view of the part of matrix.
+  template <typename V>
+  V checked(V view) const {
+    if (view.status() != STATUS::GOOD_ALLOCATOR) _Status = view.status();
+    return view;
+  }
+
+  /// @brief Is the matrix has the same rows and columns as `other`.
+  constexpr bool same_shape(const basic_matrix<T> &other) const {
+    return _Rows == other._Rows && _Columns == other._Columns;
+  }
+
   mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
 };
+
+namespace detail {
+
+/// @brief The matrix or the view, which is multiplied by its strides.
+template <typename E>
+concept strided_matrix =
+    is_basic_matrix<E>::value || requires(const E &operand) {
+      operand.data();
+      operand.row_stride();
+      operand.column_stride();
+    };
+
+/// @brief Get the view of the matrix or the view.
+template <typename T, typename E>
+matrix_view<const T> view_of(const E &operand) {
+  if constexpr (is_basic_matrix<E>::value)
+    return operand.view();
+  else
+    return matrix_view<const T>(operand);
+}
+
+/**
+ * @brief Computes the product of views by their strides. If the shapes don't
+ * match or the views have the error status, returns the matrix with one
+ * element of zero and the error status. The large products are computed by
+ * strassen() while set_strassen_cutoff() is on. @see basic_matrix::operator*()
+ */
+template <typename T>
+basic_matrix<T> multiply(matrix_view<const T> lhs, matrix_view<const T> rhs) {
+  BEZ_STATS_TEMPORARY();
+  if (lhs.status() != STATUS::GOOD_ALLOCATOR ||
+      rhs.status() != STATUS::GOOD_ALLOCATOR ||
+      lhs.columns() != rhs.rows()) {
+    basic_matrix<T> matrix(1, 1);
+    matrix._Status = lhs.status() != STATUS::GOOD_ALLOCATOR ? lhs.status()
+                     : rhs.status() != STATUS::GOOD_ALLOCATOR
+                         ? rhs.status()
+                         : STATUS::BOUND_ARRAY;
+    return matrix;
+  }
+
+  basic_matrix<T> matrix(lhs.rows(), rhs.columns());
+  if (matrix.rows() != lhs.rows()) return matrix;
+  if constexpr (strassen_supported<T>) {
+    if (strassen_splits(lhs.rows(), rhs.columns(), lhs.columns(),
+                        strassen_cutoff())) {
+      strassen(lhs.rows(), rhs.columns(), lhs.columns(), lhs.data(),
+               lhs.row_stride(), lhs.column_stride(), rhs.data(),
+               rhs.row_stride(), rhs.column_stride(), matrix.data(),
+               matrix.stride(), strassen_cutoff());
+      return matrix;
+    }
+  }
+  gemm_strided(lhs.rows(), rhs.columns(), lhs.columns(), lhs.data(),
+               lhs.row_stride(), lhs.column_stride(), rhs.data(),
+               rhs.row_stride(), rhs.column_stride(), matrix.data(),
+               matrix.stride());
+  return matrix;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Product of the matrices, the views and the expressions of matrices.
+ * The matrices and the views, e.g. `a.transpose()`, are multiplied by their
+ * strides without copying, other expressions are computed into the temporary
+ * matrices before the multiplication. @see basic_matrix::operator*()
+ *
+ * @param lhs First matrix, view or expression
+ * @param rhs Last matrix, view or expression
+ * @return Product of Matrix
+ */
+template <matrix_operand L, matrix_operand R>
+  requires(!(detail::is_basic_matrix<L>::value &&
+             detail::is_basic_matrix<R>::value) &&
+           detail::same_matrix_value<L, R>)
+auto operator*(const L &lhs, const R &rhs) {
+  using T = typename detail::matrix_node_t<L>::value_type;
+  using detail::strided_matrix, detail::view_of;
+  if constexpr (strided_matrix<L> && strided_matrix<R>)
+    return detail::multiply<T>(view_of<T>(lhs), view_of<T>(rhs));
+  else if constexpr (strided_matrix<L>)
+    return detail::multiply<T>(view_of<T>(lhs), basic_matrix<T>(rhs).view());
+  else if constexpr (strided_matrix<R>)
+    return detail::multiply<T>(basic_matrix<T>(lhs).view(), view_of<T>(rhs));
+  else
+    return detail::multiply<T>(basic_matrix<T>(lhs).view(),
+                            basic_matrix<T>(rhs).view());
+}
+
+/**
+ * @brief Get the transposed copy of the matrix, the view or the expression.
+ * The matrices and the views are copied by the tiles. @see basic_transpose.h
+ *
+ * @param matrix Matrix, view or expression
+ * @return Transposed matrix
+ */
+template <matrix_operand E>
+auto transpose(const E &matrix) {
+  using T = typename detail::matrix_node_t<E>::value_type;
+  if constexpr (detail::strided_matrix<E>)
+    return basic_matrix<T>(detail::view_of<T>(matrix).transpose());
+  else
+    return basic_matrix<T>(basic_matrix<T>(matrix).transpose());
+}
+
+namespace detail {
+
+/// @brief At least one of operands is the expression of matrices.
+template <typename L, typename R>
+concept matrix_expression_pair =
+    matrix_operand<L> && matrix_operand<R> && same_matrix_value<L, R> &&
+    !(is_basic_matrix<L>::value && is_basic_matrix<R>::value);
+
+}  // namespace detail
+
+/**
+ * @brief Comparisons of the expressions of matrices. The equality computes
+ * the elements one by one without the temporary matrices, other comparisons
+ * compute the expressions into the temporary matrices and compare them like
+ * basic_matrix.
+ */
+template <typename L, typename R>
+  requires detail::matrix_expression_pair<L, R>
+bool operator==(const L &lhs, const R &rhs) {
+  using T = typename detail::matrix_node_t<L>::value_type;
+  const auto first = detail::as_matrix_node(lhs);
+  const auto last = detail::as_matrix_node(rhs);
+  if (first.rows() != last.rows() || first.columns() != last.columns())
+    return false;
+
+  if (first.status() == STATUS::BOUND_ARRAY ||
+      last.status() == STATUS::BOUND_ARRAY) {
+    const basic_matrix<T> &left = lhs, &right = rhs;
+    return left == right;
+  }
+
+  for (size_t row = 0; row < first.rows(); row++)
+    for (size_t col = 0; col < first.columns(); col++)
+      if (first.element(row, col) != last.element(row, col)) return false;
+  return true;
+}
+
+template <typename L, typename R>
+  requires detail::matrix_expression_pair<L, R>
+bool operator<(const L &lhs, const R &rhs) {
+  using T = typename detail::matrix_node_t<L>::value_type;
+  const basic_matrix<T> &first = lhs, &last = rhs;
+  return first < last;
+}
+
+template <typename L, typename R>
+  requires detail::matrix_expression_pair<L, R>
+bool operator>(const L &lhs, const R &rhs) {
+  return rhs < lhs;
+}
+
+template <typename L, typename R>
+  requires detail::matrix_expression_pair<L, R>
+bool operator<=(const L &lhs, const R &rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename L, typename R>
+  requires detail::matrix_expression_pair<L, R>
+bool operator>=(const L &lhs, const R &rhs) {
+  return !(lhs < rhs);
+}
 }  // namespace bez
-#endif
\ No newline at end of file
+#endif
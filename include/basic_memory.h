@@ -0,0 +1,229 @@
+/**
+ * @file basic_memory.h
+ * @brief Implements the source of memory of basic_vector and basic_matrix.
+ * The memory is taken from the polymorphic memory resource, so the
+ * temporaries can be allocated in the arena and freed at once.
+ *
+ * @version 0.5
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_MEMORY
+#define BASIC_MEMORY
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+#include "basic_stats.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the default resource of the thread and
+ *   `scoped_resource`.
+ * * 2026-10-14 V0.2 The memory is aligned to the cache line. Added the tag
+ *   `uninitialized`.
+ * * 2026-10-14 V0.3 Added the tag `external`.
+ * * 2026-10-14 V0.4 Allocations are counted by the statistics.
+ * * 2026-10-14 V0.5 Added the temporary array `scratch` of any numbers.
+ *   @see basic_stats.h
+ */
+
+/**
+ * Alignment of memory of vectors and matrices in bytes. By default it's the
+ * size of cache line, so the rows of matrix and the vectors don't share the
+ * lines and the vectorized kernels don't split the loads between two lines.
+ * The short vectors stored inside basic_vector are aligned only to the type
+ * of element.
+ */
+#ifndef BEZ_MEMORY_ALIGNMENT
+#define BEZ_MEMORY_ALIGNMENT 64
+#endif
+
+namespace bez {
+
+/**
+ * @struct uninitialized_t basic_memory.h
+ *
+ * @brief Tag of constructors which allocate the memory without initializing
+ * the elements. The elements must be written before they are read.
+ * @code
+ * bez::basic_vector<double> vector(length, bez::uninitialized);
+ * @endcode
+ */
+struct uninitialized_t {
+  explicit uninitialized_t() = default;
+};
+
+inline constexpr uninitialized_t uninitialized{};
+
+/**
+ * @struct external_t basic_memory.h
+ *
+ * @brief Tag of constructors which refer to the memory of the caller without
+ * copying, e.g. to the mapped file. The memory isn't freed by the vector or
+ * the matrix and must live longer than them.
+ * @code
+ * bez::basic_vector<float> vector(buffer, length, bez::external);
+ * @endcode
+ *
+ * @details The resource of such vector is `std::pmr::null_memory_resource()`,
+ * so the assignment of the same length writes the external memory and the
+ * assignment of other length fails with `STATUS::BAD_ALLOCATOR`.
+ */
+struct external_t {
+  explicit external_t() = default;
+};
+
+inline constexpr external_t external{};
+
+namespace detail {
+
+inline std::pmr::memory_resource *&thread_resource_value() {
+  thread_local std::pmr::memory_resource *resource =
+      std::pmr::new_delete_resource();
+  return resource;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the resource of the current thread, which is used by the vectors
+ * and matrices constructed without the resource. By default it's
+ * `std::pmr::new_delete_resource()`.
+ *
+ * @return Memory resource
+ */
+inline std::pmr::memory_resource *thread_resource() noexcept {
+  return detail::thread_resource_value();
+}
+
+/**
+ * @brief Set the resource of the current thread. The threads of the pool keep
+ * their own resource. `nullptr` restores `std::pmr::new_delete_resource()`.
+ *
+ * @param resource Memory resource
+ * @return Previous resource
+ */
+inline std::pmr::memory_resource *set_thread_resource(
+    std::pmr::memory_resource *resource) noexcept {
+  std::pmr::memory_resource *previous = detail::thread_resource_value();
+  detail::thread_resource_value() =
+      resource != nullptr ? resource : std::pmr::new_delete_resource();
+  return previous;
+}
+
+/**
+ * @class scoped_resource basic_memory.h
+ *
+ * @brief Sets the resource of the current thread for the scope and restores
+ * the previous one on the end of scope.
+ *
+ * @details The vectors and matrices constructed in the scope, including the
+ * results of operations, take the memory of the `resource`. They must be
+ * destroyed before the resource. E.g. with the arena
+ * @code
+ * std::pmr::monotonic_buffer_resource arena(1 << 20);
+ * {
+ *   bez::scoped_resource scope(&arena);
+ *   bez::basic_vector<double> sum = a + b;  // In the arena
+ *   ...
+ * }
+ * arena.release();  // Frees all temporaries at once
+ * @endcode
+ */
+class scoped_resource {
+ private:
+  std::pmr::memory_resource *_Previous;  // Resource before the scope
+
+ public:
+  explicit scoped_resource(std::pmr::memory_resource *resource) noexcept
+      : _Previous(set_thread_resource(resource)) {}
+
+  scoped_resource(const scoped_resource &) = delete;
+  scoped_resource &operator=(const scoped_resource &) = delete;
+
+  ~scoped_resource() { set_thread_resource(_Previous); }
+};
+
+namespace detail {
+
+/// @brief Alignment of memory of elements of the type `T`.
+template <typename T>
+inline constexpr size_t alignment_of =
+    alignof(T) > BEZ_MEMORY_ALIGNMENT ? alignof(T) : BEZ_MEMORY_ALIGNMENT;
+
+/**
+ * @brief Allocates not initialized memory of `count` elements of the
+ * `resource` aligned to `BEZ_MEMORY_ALIGNMENT`.
+ *
+ * @return Memory or `nullptr`, if it's not allocated
+ */
+template <typename T>
+T *allocate_elements(std::pmr::memory_resource *resource,
+                     size_t count) noexcept {
+  try {
+    T *memory = static_cast<T *>(
+        resource->allocate(count * sizeof(T), alignment_of<T>));
+    BEZ_STATS_ALLOCATION(count * sizeof(T));
+    return memory;
+  } catch (const std::bad_alloc &) {
+    return nullptr;
+  }
+}
+
+/// @brief Frees the memory of `count` elements allocated by
+/// `allocate_elements()`.
+template <typename T>
+void deallocate_elements(std::pmr::memory_resource *resource, T *pointer,
+                         size_t count) noexcept {
+  if (pointer != nullptr)
+    resource->deallocate(pointer, count * sizeof(T), alignment_of<T>);
+}
+
+/**
+ * @class scratch basic_memory.h
+ *
+ * @brief Temporary array of `count` elements of the `resource` initialized to
+ * `value`, which is freed at the end of scope. Unlike `std::pmr::vector` the
+ * elements of `bool` are the contiguous array too. If the memory isn't
+ * allocated, throws `std::bad_alloc` like `std::pmr::vector`.
+ */
+template <typename T>
+class scratch {
+ public:
+  explicit scratch(size_t count, T value = T(),
+                   std::pmr::memory_resource *resource = thread_resource())
+      : _Data(allocate_elements<T>(resource, count)),
+        _Count(count),
+        _Resource(resource) {
+    if (_Data == nullptr && count != 0) throw std::bad_alloc();
+    std::uninitialized_fill_n(_Data, count, value);
+  }
+
+  scratch(const scratch &) = delete;
+  scratch &operator=(const scratch &) = delete;
+
+  ~scratch() { deallocate_elements(_Resource, _Data, _Count); }
+
+  T *data() const noexcept { return _Data; }
+  T *begin() const noexcept { return _Data; }
+  T *end() const noexcept { return _Data + _Count; }
+  T &operator[](size_t index) const noexcept { return _Data[index]; }
+
+ private:
+  T *_Data;                              // Elements
+  size_t _Count;                         // Number of elements
+  std::pmr::memory_resource *_Resource;  // Source of memory
+};
+
+}  // namespace detail
+
+}  // namespace bez
+#endif
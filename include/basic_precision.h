@@ -0,0 +1,322 @@
+/**
+ * @file basic_precision.h
+ * @brief Implements the numbers of reduced precision `float16`, `bfloat16`
+ * and `int8`, which halve or quarter the memory of elements. They are
+ * computed in the wider type of `accumulator_t` and rounded on store: the
+ * sums, the scalar products and the products of matrices of them are
+ * accumulated in `float` or `int32_t`.
+ * @code
+ * bez::basic_matrix<bez::float16> weights(rows, columns);
+ * bez::basic_matrix<bez::float16> result = weights * input;  // fp32 inside
+ * float total = weights.sum();
+ * @endcode
+ *
+ * @version 0.3
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_PRECISION
+#define BASIC_PRECISION
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `float16`, `bfloat16`, `int8` and
+ *   `accumulator_t`.
+ * * 2026-10-14 V0.2 Added `real_t`.
+ * * 2026-10-14 V0.3 Added `std::hash` of the numbers, e.g. for
+ *   `multiset_equal()`.
+ */
+
+namespace bez {
+
+namespace detail {
+
+// The conversions work on one number and on the registers of vector
+// extensions: `U` is `uint32_t` or the register of them, `F` is `float` or
+// the register of them. The branches are the selects, so the loops of
+// conversions are vectorized. The registers are passed by the references and
+// reinterpreted by the builtin, so the functions don't depend on the
+// instruction set.
+
+/// @brief Converts the bits of float16 in the low half of `h` to `value`.
+template <typename U, typename F>
+inline void half_to_float(const U &h, F &value) {
+  const U zero{};
+  U bits = (h & 0x7fffu) << 13;
+  const U exponent = bits & 0x0f800000u;
+  bits += 0x38000000u;  // (127 - 15) << 23
+  // Infinity and NaN keep all bits of exponent
+  bits = exponent == 0x0f800000u ? bits + 0x38000000u : bits;
+  // Subnormal numbers are normalized by the float point subtraction
+  const F normalized = __builtin_bit_cast(F, bits + 0x00800000u) -
+                       __builtin_bit_cast(F, zero + 0x38800000u);
+  const U subnormal = __builtin_bit_cast(U, normalized);
+  bits = exponent == 0u ? subnormal : bits;
+  value = __builtin_bit_cast(F, bits | (h & 0x8000u) << 16);
+}
+
+/// @brief Converts `value` to the bits of float16 `h` rounded to the nearest
+/// even.
+template <typename F, typename U>
+inline void float_to_half(const F &value, U &h) {
+  const U zero{};
+  U bits = __builtin_bit_cast(U, value);
+  const U sign = bits & 0x80000000u;
+  bits ^= sign;
+  // Infinity stays infinity, NaN becomes quiet NaN
+  const U special = bits > 0x7f800000u ? zero + 0x7e00u : zero + 0x7c00u;
+  // The float point addition of 0.5 rounds the subnormal numbers
+  const F rounded = __builtin_bit_cast(F, bits) +
+                    __builtin_bit_cast(F, zero + 0x3f000000u);
+  const U subnormal = __builtin_bit_cast(U, rounded) - 0x3f000000u;
+  const U normal = (bits + 0xc8000fffu + (bits >> 13 & 1u)) >> 13;
+  const U result = bits >= 0x47800000u   ? special
+                   : bits < 0x38800000u ? subnormal
+                                        : normal;
+  h = result | sign >> 16;
+}
+
+/// @brief Converts the bits of bfloat16 in the low half of `h` to `value`.
+template <typename U, typename F>
+inline void bfloat_to_float(const U &h, F &value) {
+  value = __builtin_bit_cast(F, h << 16);
+}
+
+/// @brief Converts `value` to the bits of bfloat16 `h` rounded to the nearest
+/// even.
+template <typename F, typename U>
+inline void float_to_bfloat(const F &value, U &h) {
+  const U bits = __builtin_bit_cast(U, value);
+  const U rounded = (bits + 0x7fffu + (bits >> 16 & 1u)) >> 16;
+  h = (bits & 0x7fffffffu) > 0x7f800000u ? (bits >> 16 | 0x40u) : rounded;
+}
+
+/**
+ * @struct reduced_arithmetic basic_precision.h
+ *
+ * @brief Operations of the number `D` of reduced precision. The operands are
+ * converted to `C`, and the result is rounded to `D`.
+ */
+template <typename D, typename C>
+struct reduced_arithmetic {
+  friend D operator+(D value) { return value; }
+  friend D operator-(D value) { return D(-C(value)); }
+  friend D operator+(D lhs, D rhs) { return D(C(lhs) + C(rhs)); }
+  friend D operator-(D lhs, D rhs) { return D(C(lhs) - C(rhs)); }
+  friend D operator*(D lhs, D rhs) { return D(C(lhs) * C(rhs)); }
+  friend D operator/(D lhs, D rhs) { return D(C(lhs) / C(rhs)); }
+  friend D &operator+=(D &lhs, D rhs) { return lhs = lhs + rhs; }
+  friend D &operator-=(D &lhs, D rhs) { return lhs = lhs - rhs; }
+  friend D &operator*=(D &lhs, D rhs) { return lhs = lhs * rhs; }
+  friend D &operator/=(D &lhs, D rhs) { return lhs = lhs / rhs; }
+
+  friend bool operator==(D lhs, D rhs) { return C(lhs) == C(rhs); }
+  friend auto operator<=>(D lhs, D rhs) { return C(lhs) <=> C(rhs); }
+
+  friend std::ostream &operator<<(std::ostream &os, D value) {
+    return os << C(value);
+  }
+  friend std::istream &operator>>(std::istream &is, D &value) {
+    C wide{};
+    if (is >> wide) value = D(wide);
+    return is;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @class float16 basic_precision.h
+ *
+ * @brief IEEE 754 half precision number: 1 bit of sign, 5 bits of exponent
+ * and 10 bits of mantissa. It's computed in `float`.
+ */
+class float16 : public detail::reduced_arithmetic<float16, float> {
+ public:
+  constexpr float16() = default;
+
+  /// @brief Rounds `value` to the nearest float16.
+  template <arithmetic U>
+  float16(U value) {
+    uint32_t bits;
+    detail::float_to_half(static_cast<float>(value), bits);
+    _Bits = static_cast<uint16_t>(bits);
+  }
+
+  /// @brief Get the number of the bits of float16.
+  static constexpr float16 from_bits(uint16_t bits) {
+    float16 result{};
+    result._Bits = bits;
+    return result;
+  }
+
+  /// @brief Get the bits of number.
+  constexpr uint16_t bits() const { return _Bits; }
+
+  template <arithmetic U>
+  explicit operator U() const {
+    float value;
+    detail::half_to_float(uint32_t{_Bits}, value);
+    return static_cast<U>(value);
+  }
+
+ private:
+  uint16_t _Bits;
+};
+
+/**
+ * @class bfloat16 basic_precision.h
+ *
+ * @brief Brain float point number: the high half of `float` with 8 bits of
+ * exponent and 7 bits of mantissa. It's computed in `float`.
+ */
+class bfloat16 : public detail::reduced_arithmetic<bfloat16, float> {
+ public:
+  constexpr bfloat16() = default;
+
+  /// @brief Rounds `value` to the nearest bfloat16.
+  template <arithmetic U>
+  bfloat16(U value) {
+    uint32_t bits;
+    detail::float_to_bfloat(static_cast<float>(value), bits);
+    _Bits = static_cast<uint16_t>(bits);
+  }
+
+  /// @brief Get the number of the bits of bfloat16.
+  static constexpr bfloat16 from_bits(uint16_t bits) {
+    bfloat16 result{};
+    result._Bits = bits;
+    return result;
+  }
+
+  /// @brief Get the bits of number.
+  constexpr uint16_t bits() const { return _Bits; }
+
+  template <arithmetic U>
+  explicit operator U() const {
+    float value;
+    detail::bfloat_to_float(uint32_t{_Bits}, value);
+    return static_cast<U>(value);
+  }
+
+ private:
+  uint16_t _Bits;
+};
+
+/**
+ * @class int8 basic_precision.h
+ *
+ * @brief Integer of 8 bits, which is the number, not the character like
+ * `int8_t`. It's computed in `int32_t` and wraps on store like `int8_t`.
+ */
+class int8 : public detail::reduced_arithmetic<int8, int32_t> {
+ public:
+  constexpr int8() = default;
+
+  template <arithmetic U>
+  constexpr int8(U value) : _Value(static_cast<int8_t>(value)) {}
+
+  template <arithmetic U>
+  constexpr explicit operator U() const {
+    return static_cast<U>(_Value);
+  }
+
+ private:
+  int8_t _Value;
+};
+
+// The arrays of numbers are copied by the bits like the arrays of `float`
+static_assert(sizeof(float16) == 2 && std::is_trivial_v<float16>);
+static_assert(sizeof(bfloat16) == 2 && std::is_trivial_v<bfloat16>);
+static_assert(sizeof(int8) == 1 && std::is_trivial_v<int8>);
+
+/**
+ * @struct accumulator basic_precision.h
+ *
+ * @brief Type in which the sums and the products of `T` are accumulated:
+ * `float` for float16 and bfloat16, `int32_t` for the integers of 8 and 16
+ * bits. Other types are accumulated in themselves.
+ */
+template <typename T>
+struct accumulator {
+  using type = T;
+};
+
+template <>
+struct accumulator<float16> {
+  using type = float;
+};
+
+template <>
+struct accumulator<bfloat16> {
+  using type = float;
+};
+
+template <>
+struct accumulator<int8> {
+  using type = int32_t;
+};
+
+template <>
+struct accumulator<int16_t> {
+  using type = int32_t;
+};
+
+template <>
+struct accumulator<uint16_t> {
+  using type = uint32_t;
+};
+
+template <typename T>
+using accumulator_t = typename accumulator<T>::type;
+
+/// @brief Type of the means and the norms of `T`: `accumulator_t<T>` of the
+/// float point types, otherwise `double`.
+template <typename T>
+using real_t = std::conditional_t<std::is_floating_point_v<accumulator_t<T>>,
+                                  accumulator_t<T>, double>;
+
+}  // namespace bez
+
+/// @brief Hash of the bits of float16. `-0` is equal to `0`, so it has the
+/// same hash. @see multiset_equal()
+template <>
+struct std::hash<bez::float16> {
+  size_t operator()(bez::float16 value) const noexcept {
+    const uint16_t bits = value.bits();
+    return std::hash<uint16_t>{}(bits == 0x8000u ? uint16_t{0} : bits);
+  }
+};
+
+/// @brief Hash of the bits of bfloat16. @see std::hash<bez::float16>
+template <>
+struct std::hash<bez::bfloat16> {
+  size_t operator()(bez::bfloat16 value) const noexcept {
+    const uint16_t bits = value.bits();
+    return std::hash<uint16_t>{}(bits == 0x8000u ? uint16_t{0} : bits);
+  }
+};
+
+/// @brief Hash of the value of int8.
+template <>
+struct std::hash<bez::int8> {
+  size_t operator()(bez::int8 value) const noexcept {
+    return std::hash<int8_t>{}(static_cast<int8_t>(value));
+  }
+};
+#endif
@@ -0,0 +1,354 @@
+/**
+ * @file basic_reduce.h
+ * @brief Implements the kernels of reductions of arrays and matrices in row-
+ * major order by the strategies of summation: the sums of the whole array,
+ * of the rows and of the columns. The columns are summed by the blocks of
+ * contiguous elements of rows, so the matrix is read once in order. The
+ * vectors are broadcast to the rows and the columns in the same way.
+ * @code
+ * float total = vector.sum(bez::summation::kahan);
+ * auto columns = matrix.column_sums(bez::summation::pairwise);
+ * matrix.add_rows(bias).mul_columns(scales);
+ * @endcode
+ *
+ * @version 0.3
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_REDUCE
+#define BASIC_REDUCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <type_traits>
+
+#include "basic_expression.h"
+#include "basic_memory.h"
+#include "basic_precision.h"
+#include "basic_simd.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the sums of arrays, rows and columns by the
+ *   strategies of summation.
+ * * 2026-10-14 V0.2 Added the minima, the maxima, the means and the norms of
+ *   rows and columns, and the broadcast of vectors.
+ * * 2026-10-14 V0.3 The temporary sums are `scratch`, so the matrices of
+ *   `bool` are reduced too. @see basic_memory.h
+ */
+
+namespace bez::detail {
+
+/// @brief Columns of the block, which is summed by one task.
+inline constexpr size_t column_block = 256;
+
+/// @brief Rows of the leaves of the pairwise summation of columns.
+inline constexpr size_t pairwise_rows = 8;
+
+/**
+ * @brief Sum of the contiguous array by the strategy `mode` in parallel. The
+ * pairwise and the compensated sums are split into one part per thread, so
+ * the partial sums are few and they are added in the same way.
+ */
+template <typename T>
+accumulator_t<T> parallel_sum(const T *data, size_t length,
+                              summation mode) {
+  using A = accumulator_t<T>;
+  if (mode == summation::fast)
+    return parallel_reduce(
+        length, evaluate_grain, A(0),
+        [&](size_t begin, size_t end) {
+          return simd::sum(data + begin, end - begin);
+        },
+        std::plus<A>());
+
+  const size_t grain =
+      std::max(evaluate_grain, (length + num_threads() - 1) / num_threads());
+  A compensation = 0;
+  const A total = parallel_reduce(
+      length, grain, A(0),
+      [&](size_t begin, size_t end) {
+        return simd::sum(data + begin, end - begin, mode);
+      },
+      [&](A lhs, A rhs) {
+        if constexpr (std::is_floating_point_v<A>) {
+          if (mode == summation::kahan) {
+            simd::detail::kernel<A, 1>::compensated(lhs, compensation, rhs);
+            return lhs;
+          }
+        }
+        return lhs + rhs;
+      });
+  return total + compensation;
+}
+
+/// @brief Get the row of `width` elements in the type `A`: the row itself or
+/// its copy widened into `buffer`.
+template <typename T, typename A>
+const A *widened(const T *row, A *buffer, size_t width) {
+  if constexpr (std::is_same_v<A, T>) {
+    return row;
+  } else {
+    simd::widen(row, buffer, width);
+    return buffer;
+  }
+}
+
+/**
+ * @brief Pairwise sums of `width` columns of `rows` x `width` block: the
+ * halves of rows are summed recursively into `result` and `scratch`.
+ *
+ * @param scratch Memory of `width` elements per level of recursion
+ * @param buffer  Memory of `width` elements of the widened row
+ */
+template <typename T>
+void column_pairwise(const T *data, size_t ld, size_t rows, size_t width,
+                     accumulator_t<T> *result, accumulator_t<T> *scratch,
+                     accumulator_t<T> *buffer) {
+  if (rows <= pairwise_rows) {
+    std::fill(result, result + width, accumulator_t<T>(0));
+    for (size_t row = 0; row < rows; row++)
+      simd::add(result, widened(data + row * ld, buffer, width), result,
+                width);
+    return;
+  }
+  const size_t half = rows / 2;
+  column_pairwise(data, ld, half, width, result, scratch + width, buffer);
+  column_pairwise(data + half * ld, ld, rows - half, width, scratch,
+                  scratch + width, buffer);
+  simd::add(result, scratch, result, width);
+}
+
+/**
+ * @brief Calls `f(row, index)` for the rows of `rows` x `columns` matrix in
+ * parallel. The tasks take the contiguous ranges of rows.
+ *
+ * @param data    Elements in row-major order
+ * @param ld      Distance between the rows
+ */
+template <typename T, typename F>
+void for_each_row(T *data, size_t ld, size_t rows, size_t columns, F f) {
+  parallel_for(
+      rows, std::max<size_t>(1, evaluate_grain / std::max<size_t>(columns, 1)),
+      [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; row++) f(data + row * ld, row);
+      },
+      columns);
+}
+
+/// @brief result[i] = reduce(row(i), columns) for the rows of matrix.
+/// @see for_each_row()
+template <typename T, typename R, typename F>
+void row_reduce(const T *data, size_t ld, size_t rows, size_t columns,
+                R *result, F reduce) {
+  for_each_row(data, ld, rows, columns, [&](const T *row, size_t index) {
+    result[index] = reduce(row, columns);
+  });
+}
+
+/**
+ * @brief Folds the rows of `rows` x `columns` matrix into `result` of
+ * `columns` elements, which is initialized by the caller: `fold(line, sums,
+ * width)` is called for the rows of every block of `column_block` columns in
+ * order. The line is the part of row converted to `A`.
+ *
+ * @param data    Elements in row-major order
+ * @param ld      Distance between the rows
+ */
+template <typename T, typename A, typename F>
+void column_fold(const T *data, size_t ld, size_t rows, size_t columns,
+                 A *result, F fold) {
+  parallel_for(
+      (columns + column_block - 1) / column_block, 1,
+      [&](size_t begin, size_t end) {
+        A buffer[column_block];
+        for (size_t block = begin; block < end; block++) {
+          const size_t first = block * column_block;
+          const size_t width = std::min(column_block, columns - first);
+          for (size_t row = 0; row < rows; row++)
+            fold(widened(data + row * ld + first, buffer, width),
+                 result + first, width);
+        }
+      },
+      column_block * rows);
+}
+
+/**
+ * @brief Sums the rows of `rows` x `columns` matrix into `result` of `rows`
+ * elements by the strategy `mode`.
+ *
+ * @param data    Elements in row-major order
+ * @param ld      Distance between the rows
+ * @param result  Sums of rows
+ */
+template <typename T>
+void row_sums(const T *data, size_t ld, size_t rows, size_t columns,
+              accumulator_t<T> *result, summation mode) {
+  row_reduce(data, ld, rows, columns, result,
+             [mode](const T *row, size_t n) {
+               return simd::sum(row, n, mode);
+             });
+}
+
+/**
+ * @brief Sums the columns of `rows` x `columns` matrix into `result` of
+ * `columns` elements by the strategy `mode`. The blocks of columns are
+ * summed by the tasks, and every block reads the rows in order.
+ *
+ * @param data    Elements in row-major order
+ * @param ld      Distance between the rows
+ * @param result  Sums of columns
+ */
+template <typename T>
+void column_sums(const T *data, size_t ld, size_t rows, size_t columns,
+                 accumulator_t<T> *result, summation mode) {
+  using A = accumulator_t<T>;
+  if (mode == summation::kahan && !std::is_floating_point_v<A>)
+    mode = summation::fast;  // The integers are summed exactly
+
+  size_t levels = 1;
+  for (size_t count = rows; count > pairwise_rows; count = (count + 1) / 2)
+    levels++;
+
+  parallel_for(
+      (columns + column_block - 1) / column_block, 1,
+      [&](size_t begin, size_t end) {
+        // The widened row, the compensations or the levels of recursion
+        scratch<A> buffers((levels + 1) * column_block);
+        A *buffer = buffers.data();
+        A *extra = buffer + column_block;
+        for (size_t block = begin; block < end; block++) {
+          const size_t first = block * column_block;
+          const size_t width = std::min(column_block, columns - first);
+          A *sums = result + first;
+
+          if (mode == summation::pairwise) {
+            column_pairwise(data + first, ld, rows, width, sums, extra,
+                            buffer);
+            continue;
+          }
+          std::fill(sums, sums + width, A(0));
+          std::fill(extra, extra + width, A(0));
+          for (size_t row = 0; row < rows; row++) {
+            const A *line = widened(data + row * ld + first, buffer, width);
+            if (mode == summation::kahan)
+              simd::add_kahan(line, sums, extra, width);
+            else
+              simd::add(sums, line, sums, width);
+          }
+          if (mode == summation::kahan) simd::add(sums, extra, sums, width);
+        }
+      },
+      column_block * rows);
+}
+
+/**
+ * @brief Sum of all elements of `rows` x `columns` matrix by the strategy
+ * `mode`. The contiguous matrix is summed as the array, others by the sums
+ * of rows.
+ */
+template <typename T>
+accumulator_t<T> matrix_sum(const T *data, size_t ld, size_t rows,
+                            size_t columns, summation mode) {
+  using A = accumulator_t<T>;
+  if (ld == columns || rows == 1)
+    return parallel_sum(data, rows * columns, mode);
+
+  scratch<A> sums(rows);
+  row_sums(data, ld, rows, columns, sums.data(), mode);
+  return simd::sum(sums.data(), rows, mode);
+}
+
+/**
+ * @brief Minima of columns of `rows` > 0 x `columns` matrix. `Max` selects
+ * the maxima.
+ */
+template <bool Max, typename T>
+void column_extrema(const T *data, size_t ld, size_t rows, size_t columns,
+                    T *result) {
+  std::copy(data, data + columns, result);
+  column_fold(data + ld, ld, rows - 1, columns, result,
+              [](const T *line, T *extrema, size_t width) {
+                if constexpr (Max)
+                  simd::max(extrema, line, extrema, width);
+                else
+                  simd::min(extrema, line, extrema, width);
+              });
+}
+
+/// @brief Means of rows of `rows` x `columns` > 0 matrix in `real_t<T>`.
+template <typename T>
+void row_means(const T *data, size_t ld, size_t rows, size_t columns,
+               real_t<T> *result, summation mode) {
+  using R = real_t<T>;
+  row_reduce(data, ld, rows, columns, result,
+             [mode](const T *row, size_t n) {
+               return static_cast<R>(simd::sum(row, n, mode)) /
+                      static_cast<R>(n);
+             });
+}
+
+/// @brief Means of columns of `rows` > 0 x `columns` matrix in `real_t<T>`.
+template <typename T>
+void column_means(const T *data, size_t ld, size_t rows, size_t columns,
+                  real_t<T> *result, summation mode) {
+  using A = accumulator_t<T>;
+  using R = real_t<T>;
+  if constexpr (std::is_same_v<A, R>) {
+    column_sums(data, ld, rows, columns, result, mode);
+  } else {
+    scratch<A> sums(columns);
+    column_sums(data, ld, rows, columns, sums.data(), mode);
+    std::copy(sums.begin(), sums.end(), result);
+  }
+  simd::div(result, static_cast<R>(rows), result, columns);
+}
+
+/// @brief Euclidean norms of rows of `rows` x `columns` matrix in
+/// `real_t<T>`.
+template <typename T>
+void row_norms(const T *data, size_t ld, size_t rows, size_t columns,
+               real_t<T> *result) {
+  using R = real_t<T>;
+  row_reduce(data, ld, rows, columns, result,
+             [](const T *row, size_t n) {
+               return static_cast<R>(
+                   std::sqrt(static_cast<R>(simd::dot(row, row, n))));
+             });
+}
+
+/// @brief Euclidean norms of columns of `rows` x `columns` matrix in
+/// `real_t<T>`. The squares are accumulated in `accumulator_t<T>` by the
+/// blocks of columns. @see column_fold()
+template <typename T>
+void column_norms(const T *data, size_t ld, size_t rows, size_t columns,
+                  real_t<T> *result) {
+  using A = accumulator_t<T>;
+  using R = real_t<T>;
+  const auto squares = [](const A *line, A *sums, size_t width) {
+    simd::fmadd(line, line, sums, width);
+  };
+  if constexpr (std::is_same_v<A, R>) {
+    std::fill(result, result + columns, R(0));
+    column_fold(data, ld, rows, columns, result, squares);
+    for (size_t i = 0; i < columns; i++) result[i] = std::sqrt(result[i]);
+  } else {
+    scratch<A> sums(columns, A(0));
+    column_fold(data, ld, rows, columns, sums.data(), squares);
+    for (size_t i = 0; i < columns; i++)
+      result[i] = std::sqrt(static_cast<R>(sums[i]));
+  }
+}
+
+}  // namespace bez::detail
+#endif
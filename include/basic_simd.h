@@ -0,0 +1,875 @@
+/**
+ * @file basic_simd.h
+ * @brief Implements the vectorized kernels of element-wise operations and
+ * reductions of arrays. The instruction set (SSE2, AVX2, AVX-512 or NEON) is
+ * chosen once at runtime by the features of the processor.
+ *
+ * @version 0.8
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_SIMD
+#define BASIC_SIMD
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "basic_precision.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `sum`, `dot`, `min`, `max`, `add`, `sub`, `mul`,
+ *   `div` with runtime dispatch.
+ * * 2026-10-14 V0.2 Added `equal`.
+ * * 2026-10-14 V0.3 Added `fmadd`.
+ * * 2026-10-14 V0.4 Added `axpy`.
+ * * 2026-10-14 V0.5 Added `widen`, `narrow`. `sum` and `dot` accumulate in
+ *   `accumulator_t`. @see basic_precision.h
+ * * 2026-10-14 V0.6 Added the pairwise and the compensated summation.
+ * * 2026-10-14 V0.7 Added the element-wise `min`, `max`, `mul` of arrays and
+ *   `add` of number.
+ * * 2026-10-14 V0.8 The compensated sum of unsigned numbers and `bool` is
+ *   the plain sum. `mul` of `bool` by number or array is the conjunction.
+ */
+
+// Vector extensions of GCC and Clang are used to write the kernels once for
+// all instruction sets. Other compilers use the scalar kernels.
+#if defined(__GNUC__) || defined(__clang__)
+#define BEZ_SIMD_VECTOR_EXTENSIONS 1
+#if defined(__x86_64__) || defined(__i386__)
+#define BEZ_SIMD_X86 1
+#elif defined(__ARM_NEON)
+#define BEZ_SIMD_NEON 1
+#endif
+#endif
+
+namespace bez::simd {
+
+/**
+ * @enum @class isa
+ *
+ * @brief Instruction set of the kernels.
+ */
+enum class isa {
+  scalar,  // Without vector registers
+  sse2,    // 128-bit registers of x86-64
+  avx2,    // 256-bit registers with FMA
+  avx512,  // 512-bit registers
+  neon     // 128-bit registers of ARM
+};
+
+/// @brief Defines the best instruction set supported by the processor.
+inline isa detect() noexcept {
+#if defined(BEZ_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return isa::avx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return isa::avx2;
+  return isa::sse2;
+#elif defined(BEZ_SIMD_NEON)
+  return isa::neon;
+#else
+  return isa::scalar;
+#endif
+}
+
+/// @brief Get the instruction set used by the kernels.
+inline isa active() noexcept {
+  static const isa level = detect();
+  return level;
+}
+
+/// @brief Types which have the vectorized kernels.
+template <typename T>
+concept vectorizable =
+    std::is_same_v<T, float> || std::is_same_v<T, double> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) >= 2);
+
+namespace detail {
+
+/// @brief Register of `W` elements of `T`.
+template <typename T, size_t W>
+struct lanes_of {
+#if defined(BEZ_SIMD_VECTOR_EXTENSIONS)
+  typedef T type __attribute__((vector_size(W * sizeof(T))));
+#else
+  using type = T;
+#endif
+};
+
+template <typename T>
+struct lanes_of<T, 1> {
+  using type = T;
+};
+
+/// @brief Type of bits of the number of reduced precision.
+template <typename S>
+struct storage_of {
+  using type = S;
+};
+
+template <>
+struct storage_of<float16> {
+  using type = uint16_t;
+};
+
+template <>
+struct storage_of<bfloat16> {
+  using type = uint16_t;
+};
+
+template <>
+struct storage_of<int8> {
+  using type = int8_t;
+};
+
+/// @brief Elements which are widened on the stack by the accumulating
+/// reductions.
+inline constexpr size_t widen_chunk = 256;
+
+/// @brief Get `lhs * rhs`, which is the conjunction for `bool`.
+template <typename T>
+constexpr T product(T lhs, T rhs) {
+  if constexpr (std::is_same_v<T, bool>)
+    return lhs && rhs;
+  else
+    return lhs * rhs;
+}
+
+/**
+ * @struct kernel basic_simd.h
+ *
+ * @brief Kernels which process `W` elements per register and keep 4
+ * independent accumulators in the reductions, so the additions of
+ * neighboring elements don't wait for each other.
+ *
+ * @tparam T Integral or float point number
+ * @tparam W Number of elements in register
+ */
+template <typename T, size_t W>
+struct kernel {
+  using lanes = typename lanes_of<T, W>::type;
+  static constexpr size_t U = 4;  // Unrolling of the reductions
+
+  static T sum(const T *data, size_t length) {
+    size_t i = 0;
+    T total = 0;
+    if constexpr (W > 1) {
+      lanes acc[U] = {};
+      for (; i + U * W <= length; i += U * W)
+        for (size_t u = 0; u < U; u++) {
+          lanes x;
+          std::memcpy(&x, data + i + u * W, sizeof(x));
+          acc[u] += x;
+        }
+      acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+      for (size_t j = 0; j < W; j++) total += acc[0][j];
+    }
+    for (; i < length; i++) total += data[i];
+    return total;
+  }
+
+  /// @brief Sum with the compensation of rounding by Neumaier in every lane.
+  /// The integers are summed exactly by sum().
+  static T sum_kahan(const T *data, size_t length) {
+    if constexpr (std::is_integral_v<T>) {
+      return sum(data, length);
+    } else {
+      size_t i = 0;
+      T total = 0, compensation = 0;
+      if constexpr (W > 1) {
+        lanes acc[U] = {}, error[U] = {};
+        for (; i + U * W <= length; i += U * W)
+          for (size_t u = 0; u < U; u++) {
+            lanes x;
+            std::memcpy(&x, data + i + u * W, sizeof(x));
+            const lanes next = acc[u] + x;
+            const lanes big = acc[u] < 0 ? -acc[u] : acc[u];
+            const lanes small = x < 0 ? -x : x;
+            error[u] +=
+                big >= small ? (acc[u] - next) + x : (x - next) + acc[u];
+            acc[u] = next;
+          }
+        for (size_t u = 0; u < U; u++)
+          for (size_t j = 0; j < W; j++) {
+            compensated(total, compensation, acc[u][j]);
+            compensation += error[u][j];
+          }
+      }
+      for (; i < length; i++) compensated(total, compensation, data[i]);
+      return total + compensation;
+    }
+  }
+
+  /// @brief sum[i] += data[i] with the compensation of rounding by Neumaier
+  /// in `compensation[i]`. The integers are added exactly.
+  static void add_kahan(const T *data, T *sum, T *compensation,
+                        size_t length) {
+    size_t i = 0;
+    if constexpr (std::is_integral_v<T>) {
+      add(sum, data, sum, length);
+      return;
+    } else if constexpr (W > 1) {
+      for (; i + W <= length; i += W) {
+        lanes x, acc, error;
+        std::memcpy(&x, data + i, sizeof(x));
+        std::memcpy(&acc, sum + i, sizeof(acc));
+        std::memcpy(&error, compensation + i, sizeof(error));
+        const lanes next = acc + x;
+        const lanes big = acc < 0 ? -acc : acc;
+        const lanes small = x < 0 ? -x : x;
+        error += big >= small ? (acc - next) + x : (x - next) + acc;
+        std::memcpy(sum + i, &next, sizeof(next));
+        std::memcpy(compensation + i, &error, sizeof(error));
+      }
+    }
+    for (; i < length; i++) compensated(sum[i], compensation[i], data[i]);
+  }
+
+  /// @brief Adds `value` to `total` and the lost low part to `compensation`.
+  /// The sums of unsigned numbers and `bool` lose nothing, so they are
+  /// added without the comparison of magnitudes.
+  static void compensated(T &total, T &compensation, T value) {
+    if constexpr (std::is_unsigned_v<T>) {
+      total = static_cast<T>(total + value);
+      (void)compensation;
+    } else {
+      const T next = total + value;
+      if ((total < 0 ? -total : total) >= (value < 0 ? -value : value))
+        compensation += (total - next) + value;
+      else
+        compensation += (value - next) + total;
+      total = next;
+    }
+  }
+
+  static T dot(const T *lhs, const T *rhs, size_t length) {
+    size_t i = 0;
+    T total = 0;
+    if constexpr (W > 1) {
+      lanes acc[U] = {};
+      for (; i + U * W <= length; i += U * W)
+        for (size_t u = 0; u < U; u++) {
+          lanes x, y;
+          std::memcpy(&x, lhs + i + u * W, sizeof(x));
+          std::memcpy(&y, rhs + i + u * W, sizeof(y));
+          acc[u] += x * y;
+        }
+      acc[0] = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+      for (size_t j = 0; j < W; j++) total += acc[0][j];
+    }
+    for (; i < length; i++) total += lhs[i] * rhs[i];
+    return total;
+  }
+
+  static T min(const T *data, size_t length) {
+    size_t i = 1;
+    T result = data[0];
+    if constexpr (W > 1) {
+      if (length >= W) {
+        lanes acc;
+        std::memcpy(&acc, data, sizeof(acc));
+        for (i = W; i + W <= length; i += W) {
+          lanes x;
+          std::memcpy(&x, data + i, sizeof(x));
+          acc = x < acc ? x : acc;
+        }
+        for (size_t j = 0; j < W; j++) result = std::min(result, acc[j]);
+      }
+    }
+    for (; i < length; i++) result = std::min(result, data[i]);
+    return result;
+  }
+
+  static T max(const T *data, size_t length) {
+    size_t i = 1;
+    T result = data[0];
+    if constexpr (W > 1) {
+      if (length >= W) {
+        lanes acc;
+        std::memcpy(&acc, data, sizeof(acc));
+        for (i = W; i + W <= length; i += W) {
+          lanes x;
+          std::memcpy(&x, data + i, sizeof(x));
+          acc = x > acc ? x : acc;
+        }
+        for (size_t j = 0; j < W; j++) result = std::max(result, acc[j]);
+      }
+    }
+    for (; i < length; i++) result = std::max(result, data[i]);
+    return result;
+  }
+
+  static void min(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        x = y < x ? y : x;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = std::min(lhs[i], rhs[i]);
+  }
+
+  static void max(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        x = y > x ? y : x;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = std::max(lhs[i], rhs[i]);
+  }
+
+  static bool equal(const T *lhs, const T *rhs, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + U * W <= length; i += U * W) {
+        // Masks of registers are joined, so the block of U registers is
+        // checked by one branch
+        decltype(lanes{} != lanes{}) mask = {};
+        for (size_t u = 0; u < U; u++) {
+          lanes x, y;
+          std::memcpy(&x, lhs + i + u * W, sizeof(x));
+          std::memcpy(&y, rhs + i + u * W, sizeof(y));
+          mask |= x != y;
+        }
+        for (size_t j = 0; j < W; j++)
+          if (mask[j]) return false;
+      }
+    for (; i < length; i++)
+      if (lhs[i] != rhs[i]) return false;
+    return true;
+  }
+
+  static void add(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        x += y;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = lhs[i] + rhs[i];
+  }
+
+  static void add(const T *data, T k, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x;
+        std::memcpy(&x, data + i, sizeof(x));
+        x += k;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = data[i] + k;
+  }
+
+  static void sub(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        x -= y;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = lhs[i] - rhs[i];
+  }
+
+  static void fmadd(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y, z;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        std::memcpy(&z, result + i, sizeof(z));
+        z += x * y;
+        std::memcpy(result + i, &z, sizeof(z));
+      }
+    for (; i < length; i++) result[i] += lhs[i] * rhs[i];
+  }
+
+  static void axpy(T alpha, const T *data, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, data + i, sizeof(x));
+        std::memcpy(&y, result + i, sizeof(y));
+        y += alpha * x;
+        std::memcpy(result + i, &y, sizeof(y));
+      }
+    for (; i < length; i++) result[i] += alpha * data[i];
+  }
+
+  static void mul(const T *data, T k, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x;
+        std::memcpy(&x, data + i, sizeof(x));
+        x *= k;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = product(data[i], k);
+  }
+
+  static void mul(const T *lhs, const T *rhs, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x, y;
+        std::memcpy(&x, lhs + i, sizeof(x));
+        std::memcpy(&y, rhs + i, sizeof(y));
+        x *= y;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = product(lhs[i], rhs[i]);
+  }
+
+  static void div(const T *data, T k, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1)
+      for (; i + W <= length; i += W) {
+        lanes x;
+        std::memcpy(&x, data + i, sizeof(x));
+        x /= k;
+        std::memcpy(result + i, &x, sizeof(x));
+      }
+    for (; i < length; i++) result[i] = data[i] / k;
+  }
+
+  /// @brief result[i] = data[i] in `T`. `S` is float16, bfloat16 or the
+  /// integer narrower than `T`.
+  template <typename S>
+  static void widen(const S *data, T *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1) {
+      using storage = typename storage_of<S>::type;
+      using bits = typename lanes_of<storage, W>::type;
+      using words = typename lanes_of<uint32_t, W>::type;
+      using halves = typename lanes_of<
+          std::conditional_t<std::is_signed_v<storage>, int16_t, uint16_t>,
+          W>::type;
+      for (; i + W <= length; i += W) {
+        bits x;
+        lanes y;
+        std::memcpy(&x, data + i, sizeof(x));
+        if constexpr (std::is_same_v<S, float16>)
+          bez::detail::half_to_float(__builtin_convertvector(x, words), y);
+        else if constexpr (std::is_same_v<S, bfloat16>)
+          bez::detail::bfloat_to_float(__builtin_convertvector(x, words), y);
+        else if constexpr (sizeof(T) == 4 * sizeof(storage))
+          // The bytes are widened by two steps, which are the instructions
+          y = __builtin_convertvector(__builtin_convertvector(x, halves),
+                                      lanes);
+        else
+          y = __builtin_convertvector(x, lanes);
+        std::memcpy(result + i, &y, sizeof(y));
+      }
+    }
+    for (; i < length; i++) result[i] = static_cast<T>(data[i]);
+  }
+
+  /// @brief result[i] = data[i] in `S`. The float point numbers are rounded
+  /// to the nearest even, the integers wrap. @see widen()
+  template <typename S>
+  static void narrow(const T *data, S *result, size_t length) {
+    size_t i = 0;
+    if constexpr (W > 1) {
+      using bits = typename lanes_of<typename storage_of<S>::type, W>::type;
+      using words = typename lanes_of<uint32_t, W>::type;
+      for (; i + W <= length; i += W) {
+        lanes x;
+        words w;
+        bits y;
+        std::memcpy(&x, data + i, sizeof(x));
+        if constexpr (std::is_same_v<S, float16>) {
+          bez::detail::float_to_half(x, w);
+          y = __builtin_convertvector(w, bits);
+        } else if constexpr (std::is_same_v<S, bfloat16>) {
+          bez::detail::float_to_bfloat(x, w);
+          y = __builtin_convertvector(w, bits);
+        } else {
+          y = __builtin_convertvector(x, bits);
+        }
+        std::memcpy(static_cast<void *>(result + i), &y, sizeof(y));
+      }
+    }
+    for (; i < length; i++) result[i] = static_cast<S>(data[i]);
+  }
+};
+
+/**
+ * @brief Kernels for the instruction set of `BYTES`-wide registers. The
+ * functions of sets which aren't enabled by the compiler flags are compiled
+ * with the attribute `target` and are only called when `active()` selects
+ * them.
+ */
+#define BEZ_SIMD_DEFINE_OPS(NAME, BYTES, ATTRIBUTES)                          \
+  struct NAME {                                                               \
+    template <typename T>                                                     \
+    using k = kernel<T, BYTES / sizeof(T)>;                                   \
+    template <typename T>                                                     \
+    ATTRIBUTES static T sum(const T *d, size_t n) {                           \
+      return k<T>::sum(d, n);                                                 \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static T sum_kahan(const T *d, size_t n) {                     \
+      return k<T>::sum_kahan(d, n);                                           \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void add_kahan(const T *d, T *s, T *c, size_t n) {      \
+      k<T>::add_kahan(d, s, c, n);                                            \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static T dot(const T *a, const T *b, size_t n) {               \
+      return k<T>::dot(a, b, n);                                              \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static T min(const T *d, size_t n) {                           \
+      return k<T>::min(d, n);                                                 \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static T max(const T *d, size_t n) {                           \
+      return k<T>::max(d, n);                                                 \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void min(const T *a, const T *b, T *r, size_t n) {      \
+      k<T>::min(a, b, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void max(const T *a, const T *b, T *r, size_t n) {      \
+      k<T>::max(a, b, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static bool equal(const T *a, const T *b, size_t n) {          \
+      return k<T>::equal(a, b, n);                                            \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void add(const T *a, const T *b, T *r, size_t n) {      \
+      k<T>::add(a, b, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void add(const T *a, T x, T *r, size_t n) {             \
+      k<T>::add(a, x, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void sub(const T *a, const T *b, T *r, size_t n) {      \
+      k<T>::sub(a, b, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void fmadd(const T *a, const T *b, T *r, size_t n) {    \
+      k<T>::fmadd(a, b, r, n);                                                \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void axpy(T x, const T *a, T *r, size_t n) {            \
+      k<T>::axpy(x, a, r, n);                                                 \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void mul(const T *a, T x, T *r, size_t n) {             \
+      k<T>::mul(a, x, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void mul(const T *a, const T *b, T *r, size_t n) {      \
+      k<T>::mul(a, b, r, n);                                                  \
+    }                                                                         \
+    template <typename T>                                                     \
+    ATTRIBUTES static void div(const T *a, T x, T *r, size_t n) {             \
+      k<T>::div(a, x, r, n);                                                  \
+    }                                                                         \
+    template <typename T, typename S>                                         \
+    ATTRIBUTES static void widen(const S *d, T *r, size_t n) {                \
+      k<T>::widen(d, r, n);                                                   \
+    }                                                                         \
+    template <typename T, typename S>                                         \
+    ATTRIBUTES static void narrow(const T *d, S *r, size_t n) {               \
+      k<T>::narrow(d, r, n);                                                  \
+    }                                                                         \
+  };
+
+BEZ_SIMD_DEFINE_OPS(scalar_ops, sizeof(T), )
+#if defined(BEZ_SIMD_X86)
+BEZ_SIMD_DEFINE_OPS(sse2_ops, 16, )
+BEZ_SIMD_DEFINE_OPS(avx2_ops, 32, __attribute__((target("avx2,fma"), flatten)))
+BEZ_SIMD_DEFINE_OPS(avx512_ops, 64,
+                    __attribute__((target("avx512f,avx512bw"), flatten)))
+#elif defined(BEZ_SIMD_NEON)
+BEZ_SIMD_DEFINE_OPS(neon_ops, 16, )
+#endif
+#undef BEZ_SIMD_DEFINE_OPS
+
+/**
+ * @brief Calls `function` with the kernels of the active instruction set.
+ *
+ * @param function Generic lambda which takes the kernels as the argument
+ * @return Result of the function
+ */
+template <typename T, typename F>
+decltype(auto) dispatch(F &&function) {
+  if constexpr (!vectorizable<T>) {
+    return function(scalar_ops{});
+  } else {
+    switch (active()) {
+#if defined(BEZ_SIMD_X86)
+      case isa::avx512:
+        return function(avx512_ops{});
+      case isa::avx2:
+        return function(avx2_ops{});
+      case isa::sse2:
+        return function(sse2_ops{});
+#elif defined(BEZ_SIMD_NEON)
+      case isa::neon:
+        return function(neon_ops{});
+#endif
+      default:
+        return function(scalar_ops{});
+    }
+  }
+}
+
+/// @brief Elements of the leaves of the pairwise summation, which are summed
+/// by the independent accumulators of the kernel.
+inline constexpr size_t pairwise_block = 1024;
+
+/// @brief Sum of `length` elements in `accumulator_t<T>` by the kernels
+/// `ops` of the wider type. @see widen_chunk
+template <typename Ops, typename T>
+accumulator_t<T> sum_widened(const T *data, size_t length, bool kahan) {
+  using A = accumulator_t<T>;
+  A buffer[widen_chunk];
+  A total = 0, compensation = 0;
+  for (size_t i = 0; i < length; i += widen_chunk) {
+    const size_t count = std::min(widen_chunk, length - i);
+    Ops::widen(data + i, buffer, count);
+    if (kahan)
+      kernel<A, 1>::compensated(total, compensation,
+                                Ops::sum_kahan(buffer, count));
+    else
+      total += Ops::sum(buffer, count);
+  }
+  return total + compensation;
+}
+
+/// @brief Pairwise sum: the halves are summed recursively down to
+/// `pairwise_block` elements, so the error grows as log(length).
+template <typename Ops, typename T>
+accumulator_t<T> sum_pairwise(const T *data, size_t length) {
+  if (length <= pairwise_block) {
+    if constexpr (std::is_same_v<accumulator_t<T>, T>)
+      return Ops::sum(data, length);
+    else
+      return sum_widened<Ops>(data, length, false);
+  }
+  const size_t half = length / 2;
+  return sum_pairwise<Ops>(data, half) +
+         sum_pairwise<Ops>(data + half, length - half);
+}
+
+}  // namespace detail
+
+/// @brief result[i] = data[i] in the wider type `T`, e.g. `float` of
+/// float16.
+template <typename T, typename S>
+void widen(const S *data, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::widen(data, result, length); });
+}
+
+/// @brief result[i] = data[i] in the narrower type `S`. @see widen()
+template <typename S, typename T>
+void narrow(const T *data, S *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::narrow(data, result, length); });
+}
+
+/// @brief Sum of `length` elements. The elements of reduced precision are
+/// widened by the chunks and summed in `accumulator_t<T>`.
+template <typename T>
+accumulator_t<T> sum(const T *data, size_t length) {
+  using A = accumulator_t<T>;
+  if constexpr (std::is_same_v<A, T>) {
+    return detail::dispatch<T>(
+        [&](auto ops) { return decltype(ops)::sum(data, length); });
+  } else {
+    return detail::dispatch<A>([&](auto ops) {
+      return detail::sum_widened<decltype(ops)>(data, length, false);
+    });
+  }
+}
+
+/**
+ * @brief Sum of `length` elements by the strategy `mode`. It's accumulated
+ * in `accumulator_t<T>` like sum(). @see summation
+ *
+ * @param data    Elements
+ * @param length  Number of elements
+ * @param mode    Strategy of summation
+ * @return Sum of elements
+ */
+template <typename T>
+accumulator_t<T> sum(const T *data, size_t length, summation mode) {
+  using A = accumulator_t<T>;
+  switch (mode) {
+    case summation::pairwise:
+      return detail::dispatch<A>([&](auto ops) {
+        return detail::sum_pairwise<decltype(ops)>(data, length);
+      });
+    case summation::kahan:
+      return detail::dispatch<A>([&](auto ops) {
+        if constexpr (std::is_same_v<A, T>)
+          return decltype(ops)::sum_kahan(data, length);
+        else
+          return detail::sum_widened<decltype(ops)>(data, length, true);
+      });
+    default:
+      return sum(data, length);
+  }
+}
+
+/// @brief sum[i] += data[i], the lost low parts of sums are added to
+/// compensation[i] by Neumaier. The sum is `sum[i] + compensation[i]`.
+template <typename T>
+void add_kahan(const T *data, T *sum, T *compensation, size_t length) {
+  detail::dispatch<T>([&](auto ops) {
+    decltype(ops)::add_kahan(data, sum, compensation, length);
+  });
+}
+
+/// @brief Scalar product of `length` elements. It's accumulated in
+/// `accumulator_t<T>`. @see sum()
+template <typename T>
+accumulator_t<T> dot(const T *lhs, const T *rhs, size_t length) {
+  using A = accumulator_t<T>;
+  if constexpr (std::is_same_v<A, T>) {
+    return detail::dispatch<T>(
+        [&](auto ops) { return decltype(ops)::dot(lhs, rhs, length); });
+  } else {
+    return detail::dispatch<A>([&](auto ops) {
+      A x[detail::widen_chunk], y[detail::widen_chunk];
+      A total = 0;
+      for (size_t i = 0; i < length; i += detail::widen_chunk) {
+        const size_t count = std::min(detail::widen_chunk, length - i);
+        decltype(ops)::widen(lhs + i, x, count);
+        decltype(ops)::widen(rhs + i, y, count);
+        total += decltype(ops)::dot(x, y, count);
+      }
+      return total;
+    });
+  }
+}
+
+/// @brief Minimum of `length` > 0 elements.
+template <typename T>
+T min(const T *data, size_t length) {
+  return detail::dispatch<T>(
+      [&](auto ops) { return decltype(ops)::min(data, length); });
+}
+
+/// @brief Maximum of `length` > 0 elements.
+template <typename T>
+T max(const T *data, size_t length) {
+  return detail::dispatch<T>(
+      [&](auto ops) { return decltype(ops)::max(data, length); });
+}
+
+/// @brief result[i] = min(lhs[i], rhs[i]). `result` may be `lhs` or `rhs`.
+template <typename T>
+void min(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::min(lhs, rhs, result, length); });
+}
+
+/// @brief result[i] = max(lhs[i], rhs[i]). `result` may be `lhs` or `rhs`.
+template <typename T>
+void max(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::max(lhs, rhs, result, length); });
+}
+
+/// @brief Are `length` elements equal in the same order. Stops on the first
+/// block with a different element.
+template <typename T>
+bool equal(const T *lhs, const T *rhs, size_t length) {
+  return detail::dispatch<T>(
+      [&](auto ops) { return decltype(ops)::equal(lhs, rhs, length); });
+}
+
+/// @brief result[i] = lhs[i] + rhs[i]. `result` may be `lhs` or `rhs`.
+template <typename T>
+void add(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::add(lhs, rhs, result, length); });
+}
+
+/// @brief result[i] = data[i] + k. `result` may be `data`.
+template <typename T>
+void add(const T *data, T k, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::add(data, k, result, length); });
+}
+
+/// @brief result[i] = lhs[i] - rhs[i]. `result` may be `lhs` or `rhs`.
+template <typename T>
+void sub(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::sub(lhs, rhs, result, length); });
+}
+
+/// @brief result[i] += lhs[i] * rhs[i].
+template <typename T>
+void fmadd(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::fmadd(lhs, rhs, result, length); });
+}
+
+/// @brief result[i] += alpha * data[i]. The kernels of AVX2 and AVX-512 use
+/// the fused multiply-add.
+template <typename T>
+void axpy(T alpha, const T *data, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::axpy(alpha, data, result, length); });
+}
+
+/// @brief result[i] = data[i] * k. `result` may be `data`.
+template <typename T>
+void mul(const T *data, T k, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::mul(data, k, result, length); });
+}
+
+/// @brief result[i] = lhs[i] * rhs[i]. `result` may be `lhs` or `rhs`.
+template <typename T>
+void mul(const T *lhs, const T *rhs, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::mul(lhs, rhs, result, length); });
+}
+
+/// @brief result[i] = data[i] / k. `result` may be `data`.
+template <typename T>
+void div(const T *data, T k, T *result, size_t length) {
+  detail::dispatch<T>(
+      [&](auto ops) { decltype(ops)::div(data, k, result, length); });
+}
+
+}  // namespace bez::simd
+#endif
@@ -0,0 +1,612 @@
+/**
+ * @file basic_sparse.h
+ * @brief Implements the sparse matrix in the compressed rows (CSR) or the
+ * compressed columns (CSC). Only the nonzero elements are stored, so the
+ * memory and the time of products are proportional to the number of nonzero
+ * elements.
+ * @code
+ * std::vector<bez::triplet<double>> elements = {{0, 0, 1.0}, {2, 1, 5.0}};
+ * bez::csr_matrix<double> a(1000000, 1000000, elements);
+ * bez::basic_vector<double> y = a * x;             // SpMV
+ * bez::basic_matrix<double> c = a * b;             // SpMM
+ * bez::csc_matrix<double> columns(a);              // CSR -> CSC
+ * bez::basic_matrix<double> dense = a.dense();     // Sparse -> dense
+ * @endcode
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_SPARSE
+#define BASIC_SPARSE
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "basic_blas.h"
+#include "basic_matrix.h"
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_vector.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement basic_sparse_matrix in CSR and CSC, the
+ *   products with vectors and matrices, and the conversions.
+ * * 2026-10-14 V0.2 `=` doesn't throw: the matrix of other resource is
+ *   copied, and the error of allocation sets `STATUS::BAD_ALLOCATOR`.
+ */
+
+namespace bez {
+
+/// @brief Element (row, column) of sparse matrix.
+template <number T>
+struct triplet {
+  size_t row;
+  size_t column;
+  T value;
+};
+
+/**
+ * @class basic_sparse_matrix basic_sparse.h
+ *
+ * @brief Sparse matrix, which stores only the nonzero elements. If an error
+ * occurs, determines to `_Status` such as basic_matrix.
+ *
+ * @details In CSR the elements of row `i` are `_Values[p]` in the columns
+ * `_Indices[p]` for `_Offsets[i] <= p < _Offsets[i + 1]`. CSC is the same for
+ * the columns. The elements of row (column) are sorted by the columns (rows).
+ * The arrays are taken from the memory resource such as basic_matrix. The
+ * structure isn't changed after construction, but the values are changed by
+ * `values()`.
+ *
+ * @tparam T Integral or float point number
+ * @tparam F Order of the stored elements
+ */
+template <number T, sparse_format F>
+class basic_sparse_matrix {
+ private:
+  size_t _Rows;                       // Rows of Matrix
+  size_t _Columns;                    // Columns of Matrix
+  std::pmr::vector<size_t> _Offsets;  // Starts of rows (columns) in `_Values`
+  std::pmr::vector<size_t> _Indices;  // Columns (rows) of elements
+  std::pmr::vector<T> _Values;        // Nonzero elements
+  mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+  template <number U, sparse_format G>
+  friend class basic_sparse_matrix;
+
+  /// @brief Takes the arrays of the matrix of the equal resource, so they
+  /// are moved without the allocation.
+  void take(basic_sparse_matrix &other) noexcept {
+    _Rows = other._Rows;
+    _Columns = other._Columns;
+    _Offsets.swap(other._Offsets);
+    _Indices.swap(other._Indices);
+    _Values.swap(other._Values);
+    _Status = other._Status;
+  }
+
+ public:
+  using value_type = T;
+
+  /// @brief Order of the stored elements.
+  static constexpr sparse_format format = F;
+
+  /**
+   * @brief Initialize matrix `rows` x `columns` of zeros.
+   *
+   * @param rows     Rows of matrix
+   * @param columns  Columns of matrix
+   * @param resource Source of memory. @see thread_resource()
+   */
+  basic_sparse_matrix(size_t rows, size_t columns,
+                      std::pmr::memory_resource *resource = thread_resource())
+      : _Rows(rows),
+        _Columns(columns),
+        _Offsets(major() + 1, 0, resource),
+        _Indices(resource),
+        _Values(resource) {}
+
+  /**
+   * @brief Initialize matrix `rows` x `columns` by the elements in any order.
+   * The values of the same (row, column) are added. The elements beyond the
+   * matrix are skipped with the error status `STATUS::BOUND_ARRAY`.
+   *
+   * @param rows     Rows of matrix
+   * @param columns  Columns of matrix
+   * @param elements Elements of matrix
+   * @param resource Source of memory
+   */
+  basic_sparse_matrix(size_t rows, size_t columns,
+                      std::span<const triplet<T>> elements,
+                      std::pmr::memory_resource *resource = thread_resource())
+      : basic_sparse_matrix(rows, columns, resource) {
+    // The elements are sorted by the minor index and then stably by the
+    // major index with two counting sorts
+    std::pmr::vector<size_t> counts(minor() + 1, 0, thread_resource());
+    size_t valid = 0;
+    for (const auto &element : elements) {
+      if (element.row >= _Rows || element.column >= _Columns) {
+        _Status = STATUS::BOUND_ARRAY;
+        continue;
+      }
+      counts[minor_of(element) + 1]++;
+      _Offsets[major_of(element) + 1]++;
+      valid++;
+    }
+    for (size_t j = 0; j < minor(); j++) counts[j + 1] += counts[j];
+    for (size_t i = 0; i < major(); i++) _Offsets[i + 1] += _Offsets[i];
+
+    std::pmr::vector<const triplet<T> *> order(valid, thread_resource());
+    for (const auto &element : elements)
+      if (element.row < _Rows && element.column < _Columns)
+        order[counts[minor_of(element)]++] = &element;
+
+    _Indices.resize(valid);
+    _Values.resize(valid);
+    std::pmr::vector<size_t> next(_Offsets.begin(), _Offsets.end() - 1,
+                                  thread_resource());
+    for (const triplet<T> *element : order) {
+      const size_t p = next[major_of(*element)]++;
+      _Indices[p] = minor_of(*element);
+      _Values[p] = element->value;
+    }
+
+    // The duplicates are neighbors in the rows (columns)
+    size_t end = 0, begin = 0;
+    for (size_t i = 0; i < major(); i++) {
+      const size_t last = _Offsets[i + 1];
+      for (size_t p = begin; p < last; p++) {
+        if (end > _Offsets[i] && _Indices[end - 1] == _Indices[p]) {
+          _Values[end - 1] += _Values[p];
+        } else {
+          _Indices[end] = _Indices[p];
+          _Values[end] = _Values[p];
+          end++;
+        }
+      }
+      begin = last;
+      _Offsets[i + 1] = end;
+    }
+    _Indices.resize(end);
+    _Values.resize(end);
+  }
+
+  /**
+   * @brief Initialize matrix by the nonzero elements of the dense matrix.
+   *
+   * @param dense    Matrix
+   * @param resource Source of memory
+   */
+  explicit basic_sparse_matrix(
+      const basic_matrix<T> &dense,
+      std::pmr::memory_resource *resource = thread_resource())
+      : basic_sparse_matrix(dense.rows(), dense.columns(), resource) {
+    _Status = dense._Status;
+    for (size_t i = 0; i < major(); i++)
+      for (size_t j = 0; j < minor(); j++)
+        if (dense_at(dense, i, j) != 0) _Offsets[i + 1]++;
+    for (size_t i = 0; i < major(); i++) _Offsets[i + 1] += _Offsets[i];
+
+    _Indices.reserve(_Offsets.back());
+    _Values.reserve(_Offsets.back());
+    for (size_t i = 0; i < major(); i++)
+      for (size_t j = 0; j < minor(); j++)
+        if (const T value = dense_at(dense, i, j); value != 0) {
+          _Indices.push_back(j);
+          _Values.push_back(value);
+        }
+  }
+
+  /**
+   * @brief Converts the matrix of other format, e.g. CSR to CSC, in
+   * O(nonzeros() + rows() + columns()).
+   *
+   * @param other    Matrix of other format
+   * @param resource Source of memory
+   */
+  template <sparse_format G>
+    requires(G != F)
+  explicit basic_sparse_matrix(
+      const basic_sparse_matrix<T, G> &other,
+      std::pmr::memory_resource *resource = thread_resource())
+      : basic_sparse_matrix(other._Rows, other._Columns, resource) {
+    _Status = other._Status;
+    _Indices.resize(other.nonzeros());
+    _Values.resize(other.nonzeros());
+
+    // The major index of this matrix is the minor index of `other`
+    for (size_t p = 0; p < other.nonzeros(); p++)
+      _Offsets[other._Indices[p] + 1]++;
+    for (size_t i = 0; i < major(); i++) _Offsets[i + 1] += _Offsets[i];
+
+    std::pmr::vector<size_t> next(_Offsets.begin(), _Offsets.end() - 1,
+                                  thread_resource());
+    for (size_t j = 0; j < other.major(); j++)
+      for (size_t p = other._Offsets[j]; p < other._Offsets[j + 1]; p++) {
+        const size_t q = next[other._Indices[p]]++;
+        _Indices[q] = j;
+        _Values[q] = other._Values[p];
+      }
+  }
+
+  /**
+   * @brief Copy constructor. The memory is taken from the `resource`, not from
+   * the resource of the `other`.
+   *
+   * @param other    Initialized matrix
+   * @param resource Source of memory
+   */
+  basic_sparse_matrix(const basic_sparse_matrix<T, F> &other,
+                      std::pmr::memory_resource *resource = thread_resource())
+      : _Rows(other._Rows),
+        _Columns(other._Columns),
+        _Offsets(other._Offsets, resource),
+        _Indices(other._Indices, resource),
+        _Values(other._Values, resource),
+        _Status(other._Status) {
+    BEZ_STATS_COPY();
+  }
+
+  /// @brief Move constructor. Takes the memory and the resource of the
+  /// `other`.
+  basic_sparse_matrix(basic_sparse_matrix<T, F> &&other) noexcept = default;
+
+  /// @brief Copies the elements. The matrix keeps its resource. If the memory
+  /// isn't allocated, the matrix isn't changed and takes the error status
+  /// `STATUS::BAD_ALLOCATOR`.
+  basic_sparse_matrix<T, F> &operator=(const basic_sparse_matrix<T, F> &other) {
+    if (this == &other) return *this;
+    try {
+      basic_sparse_matrix<T, F> copy(other, memory_resource());
+      take(copy);
+    } catch (const std::bad_alloc &) {
+      _Status = STATUS::BAD_ALLOCATOR;
+    }
+    return *this;
+  }
+
+  /// @brief Takes the memory of the `other`, if the resources are equal,
+  /// otherwise copies the elements like `operator=(const
+  /// basic_sparse_matrix &)`.
+  basic_sparse_matrix<T, F> &operator=(
+      basic_sparse_matrix<T, F> &&other) noexcept {
+    if (this == &other) return *this;
+    if (!memory_resource()->is_equal(*other.memory_resource()))
+      return *this = other;
+    take(other);
+    return *this;
+  }
+
+  /**
+   * @brief Get rows
+   *
+   * @return Rows of matrix
+   */
+  constexpr size_t rows() const { return _Rows; }
+
+  /**
+   * @brief Get columns
+   *
+   * @return Columns of matrix
+   */
+  constexpr size_t columns() const { return _Columns; }
+
+  /// @brief Get the number of stored elements.
+  size_t nonzeros() const { return _Values.size(); }
+
+  /// @brief Get the starts of rows (CSR) or columns (CSC) of `rows() + 1`
+  /// (`columns() + 1`) elements.
+  std::span<const size_t> offsets() const { return _Offsets; }
+
+  /// @brief Get the columns (CSR) or the rows (CSC) of stored elements.
+  std::span<const size_t> indices() const { return _Indices; }
+
+  /// @brief Get the stored elements.
+  std::span<const T> values() const { return _Values; }
+
+  /// @brief Get the stored elements to change them in place.
+  std::span<T> values() { return _Values; }
+
+  /**
+   * @brief Get the element. The element, which isn't stored, is zero. If the
+   * element is beyond the matrix, returns zero with the error status
+   * `STATUS::BOUND_ARRAY`.
+   *
+   * @param row     Index of row
+   * @param column  Index of column
+   * @return Value of element
+   */
+  T at(const size_t row, const size_t column) const {
+    if (row >= _Rows || column >= _Columns) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
+    }
+    const size_t i = F == sparse_format::csr ? row : column;
+    const size_t j = F == sparse_format::csr ? column : row;
+    const auto first = _Indices.begin() + _Offsets[i];
+    const auto last = _Indices.begin() + _Offsets[i + 1];
+    const auto found = std::lower_bound(first, last, j);
+    return found != last && *found == j ? _Values[found - _Indices.begin()]
+                                        : T(0);
+  }
+
+  /// @see at()
+  T operator()(const size_t row, const size_t column) const {
+    return at(row, column);
+  }
+
+  /**
+   * @brief Get the dense matrix of the same elements.
+   *
+   * @return Matrix
+   */
+  basic_matrix<T> dense() const {
+    basic_matrix<T> matrix(_Rows, _Columns);
+    matrix._Status = _Status;
+    for (size_t i = 0; i < major(); i++)
+      for (size_t p = _Offsets[i]; p < _Offsets[i + 1]; p++) {
+        if constexpr (F == sparse_format::csr)
+          matrix.set(i, _Indices[p], _Values[p]);
+        else
+          matrix.set(_Indices[p], i, _Values[p]);
+      }
+    return matrix;
+  }
+
+  /**
+   * @brief Get the transposed matrix. The rows of CSR are the columns of the
+   * transposed matrix, so it's CSC of the same arrays.
+   *
+   * @return Transposed matrix of other format
+   */
+  auto transpose() const {
+    constexpr sparse_format G =
+        F == sparse_format::csr ? sparse_format::csc : sparse_format::csr;
+    basic_sparse_matrix<T, G> matrix(_Columns, _Rows, memory_resource());
+    matrix._Offsets = _Offsets;
+    matrix._Indices = _Indices;
+    matrix._Values = _Values;
+    matrix._Status = _Status;
+    return matrix;
+  }
+
+  /**
+   * @brief Get the status of error
+   *
+   * @return Error status
+   */
+  STATUS status() const { return _Status; }
+
+  /**
+   * @brief Get the name of error
+   *
+   * @return Name of error status
+   */
+  const std::string to_string_status() const { return to_string(_Status); }
+
+  /**
+   * @brief Return the product of matrix and vector (SpMV). If the columns of
+   * matrix aren't equal to the length of vector, returns the vector with one
+   * element of zero and the error status `STATUS::BOUND_ARRAY`. @see gemv()
+   *
+   * @param vector Vector
+   * @return Product of matrix and vector
+   */
+  basic_vector<T> operator*(const basic_vector<T> &vector) const {
+    BEZ_STATS_TEMPORARY();
+    if (_Columns != vector.length()) {
+      basic_vector<T> result(1);
+      result._Status = STATUS::BOUND_ARRAY;
+      return result;
+    }
+    basic_vector<T> result(_Rows, uninitialized);
+    gemv(T(1), *this, vector, T(0), result);
+    return result;
+  }
+
+  /**
+   * @brief Return the product of sparse matrix and dense matrix (SpMM). If the
+   * columns of `this` aren't equal to the rows of `matrix`, returns the matrix
+   * with one element of zero and the error status `STATUS::BOUND_ARRAY`.
+   * @see gemm()
+   *
+   * @param matrix Dense matrix
+   * @return Product of matrices
+   */
+  basic_matrix<T> operator*(const basic_matrix<T> &matrix) const {
+    BEZ_STATS_TEMPORARY();
+    if (_Columns != matrix.rows()) {
+      basic_matrix<T> result(1, 1);
+      result._Status = STATUS::BOUND_ARRAY;
+      return result;
+    }
+    basic_matrix<T> result(_Rows, matrix.columns(), uninitialized);
+    gemm(T(1), *this, matrix, T(0), result);
+    return result;
+  }
+
+ private:
+  /// @brief Rows (CSR) or columns (CSC) of matrix.
+  constexpr size_t major() const {
+    return F == sparse_format::csr ? _Rows : _Columns;
+  }
+
+  /// @brief Columns (CSR) or rows (CSC) of matrix.
+  constexpr size_t minor() const {
+    return F == sparse_format::csr ? _Columns : _Rows;
+  }
+
+  static size_t major_of(const triplet<T> &element) {
+    return F == sparse_format::csr ? element.row : element.column;
+  }
+
+  static size_t minor_of(const triplet<T> &element) {
+    return F == sparse_format::csr ? element.column : element.row;
+  }
+
+  /// @brief Get the element (i, j) of the dense matrix in the major and the
+  /// minor indices.
+  static T dense_at(const basic_matrix<T> &dense, size_t i, size_t j) {
+    return F == sparse_format::csr ? dense.data()[i * dense.stride() + j]
+                                   : dense.data()[j * dense.stride() + i];
+  }
+
+  std::pmr::memory_resource *memory_resource() const {
+    return _Values.get_allocator().resource();
+  }
+};
+
+/// @brief Sparse matrix of compressed rows.
+template <number T>
+using csr_matrix = basic_sparse_matrix<T, sparse_format::csr>;
+
+/// @brief Sparse matrix of compressed columns.
+template <number T>
+using csc_matrix = basic_sparse_matrix<T, sparse_format::csc>;
+
+/**
+ * @brief Computes the product of sparse matrix and vector into the existing
+ * vector: y = alpha * a * x + beta * y. The rows of CSR are computed in
+ * parallel. If `beta` is 0, the elements of `y` are only written. If the
+ * shapes don't match, `y` isn't changed. @see gemv() in basic_blas.h
+ *
+ * @param alpha Factor of the product
+ * @param a     `m` x `n` sparse matrix
+ * @param x     Vector of `n` elements
+ * @param beta  Factor of `y`
+ * @param y     Vector of `m` elements
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, otherwise
+ * `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T, sparse_format F>
+STATUS gemv(T alpha, const basic_sparse_matrix<T, F> &a,
+            const basic_vector<T> &x, T beta, basic_vector<T> &y) {
+  const size_t m = a.rows(), n = a.columns();
+  if (n != x.length() || m != y.length()) return STATUS::BOUND_ARRAY;
+  if (m == 0) return STATUS::GOOD_ALLOCATOR;
+  BEZ_STATS_OPERATION(multiply, m, 2 * a.nonzeros());
+
+  const size_t *offsets = a.offsets().data();
+  const size_t *indices = a.indices().data();
+  const T *values = a.values().data();
+  if constexpr (F == sparse_format::csr) {
+    const size_t weight = a.nonzeros() / m + 1;  // Elements of row
+    parallel_for(
+        m, std::max<size_t>(1, detail::evaluate_grain / weight),
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            T total = 0;
+            for (size_t p = offsets[i]; p < offsets[i + 1]; p++)
+              total += values[p] * x.data()[indices[p]];
+            T &value = y.data()[i];
+            value = (beta == 0 ? T(0) : beta * value) + alpha * total;
+          }
+        },
+        weight);
+  } else {
+    // The columns are added to the scattered elements of `y`
+    detail::scale_by(y.data(), m, beta);
+    if (alpha == 0) return STATUS::GOOD_ALLOCATOR;
+    for (size_t j = 0; j < n; j++) {
+      const T factor = alpha * x.data()[j];
+      for (size_t p = offsets[j]; p < offsets[j + 1]; p++)
+        y.data()[indices[p]] += values[p] * factor;
+    }
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+/**
+ * @brief Computes the product of sparse matrix and dense matrix into the
+ * existing matrix: c = alpha * a * b + beta * c. The rows of `b` multiplied by
+ * the elements of `a` are added to the rows of `c` by the vectorized kernel.
+ * The dense matrix may be the view, e.g. `b.transpose()`. If `beta` is 0, the
+ * elements of `c` are only written. If the shapes don't match, `c` isn't
+ * changed. @see gemm() in basic_blas.h
+ *
+ * @param alpha Factor of the product
+ * @param a     `m` x `k` sparse matrix
+ * @param b     `k` x `n` matrix or view
+ * @param beta  Factor of `c`
+ * @param c     `m` x `n` matrix
+ * @return `STATUS::BOUND_ARRAY` if the shapes don't match, the status of the
+ * view if it's bad, otherwise `STATUS::GOOD_ALLOCATOR`
+ */
+template <typename T, sparse_format F, detail::strided_matrix B>
+STATUS gemm(T alpha, const basic_sparse_matrix<T, F> &a, const B &b, T beta,
+            basic_matrix<T> &c) {
+  const matrix_view<const T> rhs = detail::view_of<T>(b);
+  if (rhs.status() != STATUS::GOOD_ALLOCATOR) return rhs.status();
+  const size_t m = a.rows(), n = rhs.columns(), k = a.columns();
+  if (k != rhs.rows() || m != c.rows() || n != c.columns())
+    return STATUS::BOUND_ARRAY;
+  if (m == 0 || n == 0) return STATUS::GOOD_ALLOCATOR;
+  BEZ_STATS_OPERATION(multiply, m * n, 2 * a.nonzeros() * n);
+
+  const size_t *offsets = a.offsets().data();
+  const size_t *indices = a.indices().data();
+  const T *values = a.values().data();
+  const size_t rs = rhs.row_stride(), cs = rhs.column_stride();
+
+  // Adds `factor` * row `p` of `b` to the columns [begin, end) of `line`
+  const auto add_row = [&](T factor, size_t p, T *line, size_t begin,
+                           size_t end) {
+    const T *other = rhs.data() + p * rs;
+    if (cs == 1)
+      simd::axpy(factor, other + begin, line + begin, end - begin);
+    else
+      for (size_t j = begin; j < end; j++) line[j] += factor * other[j * cs];
+  };
+
+  if constexpr (F == sparse_format::csr) {
+    const size_t weight = (a.nonzeros() / m + 1) * n;  // Work of row
+    parallel_for(
+        m, std::max<size_t>(1, detail::evaluate_grain / weight),
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            T *line = c.data() + i * c.stride();
+            detail::scale_by(line, n, beta);
+            if (alpha == 0) continue;
+            for (size_t p = offsets[i]; p < offsets[i + 1]; p++)
+              add_row(alpha * values[p], indices[p], line, 0, n);
+          }
+        },
+        weight);
+  } else {
+    // The rows of `c` are shared by the columns of `a`, so the threads
+    // compute the separate ranges of columns of `c`
+    const size_t ranges = 4 * num_threads();
+    parallel_for(
+        n, (n + ranges - 1) / ranges,
+        [&](size_t begin, size_t end) {
+          for (size_t i = 0; i < m; i++)
+            detail::scale_by(c.data() + i * c.stride() + begin, end - begin,
+                             beta);
+          if (alpha == 0) return;
+          for (size_t j = 0; j < k; j++)
+            for (size_t p = offsets[j]; p < offsets[j + 1]; p++)
+              add_row(alpha * values[p], j,
+                      c.data() + indices[p] * c.stride(), begin, end);
+        },
+        a.nonzeros() + m);
+  }
+  return STATUS::GOOD_ALLOCATOR;
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,323 @@
+/**
+ * @file basic_stats.h
+ * @brief Implements the optional counters of allocations, copies,
+ * temporaries and operations of basic_vector and basic_matrix. The counters
+ * are compiled only with `BEZ_STATS=1`, otherwise the statistics are zeros
+ * and the library has no overhead.
+ * @code
+ * // g++ -DBEZ_STATS=1 ...
+ * bez::reset_statistics();
+ * bez::basic_matrix<double> c = a * b;
+ * const bez::stats s = bez::statistics();
+ * s[bez::operation::multiply].flops;  // 2 * m * n * k
+ * @endcode
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_STATS
+#define BASIC_STATS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the counters of allocations, copies,
+ *   temporaries and operations.
+ * * 2026-10-14 V0.2 Implement `sharded_counter`. The counters are sharded
+ *   between the threads.
+ */
+
+/**
+ * Enables the counters. The counters are sharded between the threads, so
+ * they are correct with the thread pool, but each operation takes two
+ * readings of clock.
+ */
+#ifndef BEZ_STATS
+#define BEZ_STATS 0
+#endif
+
+#if BEZ_STATS
+#include <chrono>
+#endif
+
+namespace bez {
+
+namespace detail {
+
+/// @brief Index of the shard of the current thread. The threads take the
+/// shards in turn.
+inline size_t shard_index() noexcept {
+  static std::atomic<size_t> next{0};
+  thread_local const size_t index =
+      next.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+}  // namespace detail
+
+/**
+ * @class sharded_counter basic_stats.h
+ *
+ * @brief Counter which is changed by many threads without the contention.
+ * Each thread changes its own shard on the separate cache line, the value is
+ * the sum of the shards. It's lock-free and doesn't allocate the memory.
+ *
+ * @details The value is exact when the changes are finished. While the
+ * threads change the counter, the value may be older than some changes. If
+ * there are more than `shards` threads, some threads share the shards.
+ */
+class sharded_counter {
+ public:
+  /// @brief Number of shards.
+  static constexpr size_t shards = 32;
+
+  constexpr sharded_counter() noexcept = default;
+
+  sharded_counter(const sharded_counter &) = delete;
+  sharded_counter &operator=(const sharded_counter &) = delete;
+
+  /// @brief Adds `value` to the shard of the current thread.
+  void add(int64_t value = 1) noexcept {
+    _Shards[detail::shard_index() % shards].value.fetch_add(
+        value, std::memory_order_relaxed);
+  }
+
+  void increment() noexcept { add(1); }
+
+  void decrement() noexcept { add(-1); }
+
+  /// @brief Get the sum of shards.
+  int64_t value() const noexcept {
+    int64_t total = 0;
+    for (const auto &shard : _Shards)
+      total += shard.value.load(std::memory_order_relaxed);
+    return total;
+  }
+
+  /// @brief Sets the shards to zero.
+  void reset() noexcept {
+    for (auto &shard : _Shards)
+      shard.value.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  /// @brief Value of one thread, aligned to exclude false sharing.
+  struct alignas(64) shard {
+    std::atomic<int64_t> value{0};
+  };
+
+  shard _Shards[shards];  // Values of threads
+};
+
+/// @brief Are the counters compiled. @see BEZ_STATS
+inline constexpr bool stats_enabled = BEZ_STATS != 0;
+
+/**
+ * @enum @class operation
+ *
+ * @brief Operations which are counted by the statistics.
+ */
+enum class operation : uint8_t {
+  expression,  // Computing of expressions `+`, `-`, `*`, `/`, `+=`, `-=`
+  scale,       // Operations `*=` and `/=` by number
+  sum,         // Sum of elements
+  dot,         // Scalar product and norm
+  min,         // Minimum and maximum of elements
+  equal,       // Comparison `==`
+  multiply,    // Product of matrices
+  count        // Number of operations
+};
+
+/**
+ * @brief Get the name of operation.
+ *
+ * @param op Operation
+ * @return Name of operation
+ */
+inline std::string to_string(operation op) {
+  switch (op) {
+    case operation::expression:
+      return "expression";
+    case operation::scale:
+      return "scale";
+    case operation::sum:
+      return "sum";
+    case operation::dot:
+      return "dot";
+    case operation::min:
+      return "min";
+    case operation::equal:
+      return "equal";
+    case operation::multiply:
+      return "multiply";
+    default:
+      return "unknown";
+  }
+}
+
+/// @brief Statistics of the operation.
+struct operation_stats {
+  uint64_t calls{0};        // Number of calls
+  uint64_t elements{0};     // Processed elements of results
+  uint64_t flops{0};        // Arithmetic operations of elements
+  uint64_t nanoseconds{0};  // Time of calls
+};
+
+/**
+ * @struct stats basic_stats.h
+ *
+ * @brief Copy of the counters since the start or `reset_statistics()`.
+ *
+ * @details The vectors stored inside the object aren't counted as the
+ * allocations. The temporaries are the vectors and matrices computed from
+ * the expressions and the products of matrices. The time of the operation
+ * includes the time of nested operations.
+ */
+struct stats {
+  uint64_t allocations{0};      // Number of allocations
+  uint64_t bytes_allocated{0};  // Bytes of allocations
+  uint64_t copies{0};           // Copies of vectors and matrices
+  uint64_t temporaries{0};      // Computed vectors and matrices
+  operation_stats operations[static_cast<size_t>(operation::count)]{};
+
+  const operation_stats &operator[](operation op) const {
+    return operations[static_cast<size_t>(op)];
+  }
+};
+
+#if BEZ_STATS
+namespace detail {
+
+/// @brief Counters of operation. @see operation_stats
+struct operation_counters {
+  sharded_counter calls, elements, flops, nanoseconds;
+};
+
+/// @brief Counters of the process. @see stats
+struct stats_counters {
+  sharded_counter allocations, bytes_allocated, copies, temporaries;
+  operation_counters operations[static_cast<size_t>(operation::count)];
+};
+
+inline stats_counters &counters() {
+  static stats_counters instance;
+  return instance;
+}
+
+inline void count(sharded_counter &counter, uint64_t value = 1) {
+  counter.add(static_cast<int64_t>(value));
+}
+
+/**
+ * @class operation_scope basic_stats.h
+ *
+ * @brief Counts the call of operation and its time until the end of scope.
+ */
+class operation_scope {
+ private:
+  operation_counters &_Counters;
+  std::chrono::steady_clock::time_point _Start;
+
+ public:
+  operation_scope(operation op, uint64_t elements, uint64_t flops)
+      : _Counters(counters().operations[static_cast<size_t>(op)]),
+        _Start(std::chrono::steady_clock::now()) {
+    count(_Counters.calls);
+    count(_Counters.elements, elements);
+    count(_Counters.flops, flops);
+  }
+
+  operation_scope(const operation_scope &) = delete;
+  operation_scope &operator=(const operation_scope &) = delete;
+
+  ~operation_scope() {
+    const auto time = std::chrono::steady_clock::now() - _Start;
+    count(_Counters.nanoseconds,
+          static_cast<uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(time)
+                  .count()));
+  }
+};
+
+}  // namespace detail
+#endif
+
+/**
+ * @brief Get the copy of counters. Without `BEZ_STATS` it's zeros.
+ *
+ * @return Statistics
+ */
+inline stats statistics() {
+  stats result;
+#if BEZ_STATS
+  const auto &counters = detail::counters();
+  result.allocations = counters.allocations.value();
+  result.bytes_allocated = counters.bytes_allocated.value();
+  result.copies = counters.copies.value();
+  result.temporaries = counters.temporaries.value();
+  for (size_t i = 0; i < static_cast<size_t>(operation::count); i++) {
+    const auto &from = counters.operations[i];
+    auto &to = result.operations[i];
+    to.calls = from.calls.value();
+    to.elements = from.elements.value();
+    to.flops = from.flops.value();
+    to.nanoseconds = from.nanoseconds.value();
+  }
+#endif
+  return result;
+}
+
+/// @brief Sets the counters to zero.
+inline void reset_statistics() {
+#if BEZ_STATS
+  auto &counters = detail::counters();
+  counters.allocations.reset();
+  counters.bytes_allocated.reset();
+  counters.copies.reset();
+  counters.temporaries.reset();
+  for (auto &op : counters.operations) {
+    op.calls.reset();
+    op.elements.reset();
+    op.flops.reset();
+    op.nanoseconds.reset();
+  }
+#endif
+}
+
+}  // namespace bez
+
+/**
+ * Macros of the counting. Without `BEZ_STATS` they are empty.
+ * `BEZ_STATS_OPERATION` counts until the end of the current scope.
+ */
+#if BEZ_STATS
+#define BEZ_STATS_ALLOCATION(bytes)                                  \
+  (::bez::detail::count(::bez::detail::counters().allocations),      \
+   ::bez::detail::count(::bez::detail::counters().bytes_allocated,   \
+                        static_cast<uint64_t>(bytes)))
+#define BEZ_STATS_COPY() \
+  ::bez::detail::count(::bez::detail::counters().copies)
+#define BEZ_STATS_TEMPORARY() \
+  ::bez::detail::count(::bez::detail::counters().temporaries)
+#define BEZ_STATS_OPERATION(op, elements, flops)                       \
+  const ::bez::detail::operation_scope bez_stats_scope_(               \
+      ::bez::operation::op, static_cast<uint64_t>(elements),           \
+      static_cast<uint64_t>(flops))
+#else
+#define BEZ_STATS_ALLOCATION(bytes) ((void)0)
+#define BEZ_STATS_COPY() ((void)0)
+#define BEZ_STATS_TEMPORARY() ((void)0)
+#define BEZ_STATS_OPERATION(op, elements, flops) ((void)0)
+#endif
+
+#endif
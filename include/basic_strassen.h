@@ -0,0 +1,275 @@
+/**
+ * @file basic_strassen.h
+ * @brief Implements the fast multiplication of large matrices by the
+ * Strassen-Winograd algorithm: the product of 2 x 2 blocks is computed by 7
+ * products of blocks and 15 additions instead of 8 products. The blocks are
+ * split recursively while their sides are at least twice the cutoff, the
+ * leaves are multiplied by the blocked kernel. @see gemm_strided()
+ * @code
+ * bez::set_strassen_cutoff(1024);  // a * b of large matrices is fast
+ * bez::basic_matrix<double> c = a * b;
+ * @endcode
+ *
+ * @details The fast product isn't as accurate as the classic one. The classic
+ * product has the componentwise bound |C - C'| <= k * u * |A| * |B|, where u
+ * is the unit roundoff, so every element is accurate relative to its terms.
+ * The bound of Strassen-Winograd is normwise, for square matrices of order
+ * `n` split down to the leaves of order `n0`:
+ *
+ *   max|C - C'| <= ((n / n0)^log2(18) * (n0^2 + 6 * n0) - 6 * n) * u *
+ *                  max|A| * max|B| + O(u^2),
+ *
+ * (N. J. Higham, Accuracy and Stability of Numerical Algorithms, 23.2.2),
+ * i.e. each level of recursion multiplies the error by about 18 / 4 = 4.5.
+ * The small elements of C may lose their relative accuracy, when the large
+ * elements of A and B cancel. Therefore the mode is opt-in and is used only
+ * for the numbers of floating point.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_STRASSEN
+#define BASIC_STRASSEN
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+#include "basic_expression.h"
+#include "basic_gemm.h"
+#include "basic_memory.h"
+#include "basic_simd.h"
+#include "basic_thread_pool.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the Strassen-Winograd multiplication with the
+ *   workspace of the memory resource of the thread.
+ */
+
+namespace bez {
+
+namespace detail {
+
+inline std::atomic<size_t> &strassen_cutoff_value() {
+  static std::atomic<size_t> cutoff{0};
+  return cutoff;
+}
+
+/**
+ * @struct strided basic_strassen.h
+ *
+ * @brief Block of matrix: the element (i, j) is `data[i * rs + j * cs]`.
+ */
+template <typename T>
+struct strided {
+  T *data;
+  size_t rs;
+  size_t cs;
+
+  /// @brief Block from the element (i, j).
+  strided at(size_t i, size_t j) const {
+    return {data + i * rs + j * cs, rs, cs};
+  }
+};
+
+/// @brief Whether `m` x `k` and `k` x `n` blocks are split by `cutoff`.
+inline bool strassen_splits(size_t m, size_t n, size_t k, size_t cutoff) {
+  return cutoff != 0 && std::min({m, n, k}) >= 2 * cutoff;
+}
+
+/**
+ * @brief Elements of the workspace of the product: the temporary blocks of
+ * each level of recursion. The 7 products of one level are computed one by
+ * one, so they share the workspace of the next level.
+ */
+inline size_t strassen_workspace(size_t m, size_t n, size_t k, size_t cutoff) {
+  size_t elements = 0;
+  while (strassen_splits(m, n, k, cutoff)) {
+    m /= 2, n /= 2, k /= 2;
+    elements += m * std::max(k, n) + k * n;
+  }
+  return elements;
+}
+
+/**
+ * @brief out = x + y or out = x - y for `m` x `n` blocks in parallel. `out`
+ * is contiguous by the rows and may be `x` or `y`.
+ *
+ * @param subtract Whether `y` is subtracted
+ */
+template <typename T>
+void strassen_combine(size_t m, size_t n, strided<const T> x,
+                      strided<const T> y, strided<T> out, bool subtract) {
+  parallel_for(
+      m, std::max<size_t>(1, evaluate_grain / std::max<size_t>(n, 1)),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          const T *lhs = x.data + i * x.rs, *rhs = y.data + i * y.rs;
+          T *result = out.data + i * out.rs;
+          if (x.cs == 1 && y.cs == 1) {
+            if (subtract)
+              simd::sub(lhs, rhs, result, n);
+            else
+              simd::add(lhs, rhs, result, n);
+          } else {
+            for (size_t j = 0; j < n; j++)
+              result[j] = subtract ? lhs[j * x.cs] - rhs[j * y.cs]
+                                   : lhs[j * x.cs] + rhs[j * y.cs];
+          }
+        }
+      },
+      n);
+}
+
+/// @brief c = a * b of the `m` x `n` block `c`, which is contiguous by the
+/// rows.
+template <typename T>
+void classic_product(size_t m, size_t n, size_t k, strided<const T> a,
+                     strided<const T> b, strided<T> c) {
+  for (size_t i = 0; i < m; i++) std::fill_n(c.data + i * c.rs, n, T(0));
+  gemm_strided(m, n, k, a.data, a.rs, a.cs, b.data, b.rs, b.cs, c.data, c.rs);
+}
+
+/**
+ * @brief c = a * b of `m` x `k` block `a` and `k` x `n` block `b` by the
+ * Strassen-Winograd algorithm. The schedule of Douglas et al. keeps the sums
+ * of `a` and the first product in `x` and the sums of `b` in `y`, the other
+ * products are computed in the blocks of `c`. The odd last row, column and
+ * term are added by the classic product.
+ *
+ * @param cutoff    Minimal side of the leaves
+ * @param workspace Elements of strassen_workspace()
+ */
+template <typename T>
+void strassen_winograd(size_t m, size_t n, size_t k, strided<const T> a,
+                       strided<const T> b, strided<T> c, size_t cutoff,
+                       T *workspace) {
+  if (!strassen_splits(m, n, k, cutoff)) {
+    classic_product(m, n, k, a, b, c);
+    return;
+  }
+
+  const size_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  const strided<const T> a11 = a, a12 = a.at(0, k2), a21 = a.at(m2, 0),
+                         a22 = a.at(m2, k2);
+  const strided<const T> b11 = b, b12 = b.at(0, n2), b21 = b.at(k2, 0),
+                         b22 = b.at(k2, n2);
+  const strided<T> c11 = c, c12 = c.at(0, n2), c21 = c.at(m2, 0),
+                   c22 = c.at(m2, n2);
+  const strided<T> x{workspace, k2, 1}, p1{workspace, n2, 1};
+  const strided<T> y{workspace + m2 * std::max(k2, n2), n2, 1};
+  T *next = y.data + k2 * n2;
+
+  auto in = [](strided<T> block) {
+    return strided<const T>{block.data, block.rs, block.cs};
+  };
+  auto add = [&](size_t rows, size_t columns, strided<const T> lhs,
+                 strided<const T> rhs, strided<T> out) {
+    strassen_combine(rows, columns, lhs, rhs, out, false);
+  };
+  auto sub = [&](size_t rows, size_t columns, strided<const T> lhs,
+                 strided<const T> rhs, strided<T> out) {
+    strassen_combine(rows, columns, lhs, rhs, out, true);
+  };
+  auto product = [&](strided<const T> lhs, strided<const T> rhs,
+                     strided<T> out) {
+    strassen_winograd(m2, n2, k2, lhs, rhs, out, cutoff, next);
+  };
+
+  sub(m2, k2, a11, a21, x);            // S3 = A11 - A21
+  sub(k2, n2, b22, b12, y);            // T3 = B22 - B12
+  product(in(x), in(y), c21);          // P7 = S3 * T3
+  add(m2, k2, a21, a22, x);            // S1 = A21 + A22
+  sub(k2, n2, b12, b11, y);            // T1 = B12 - B11
+  product(in(x), in(y), c22);          // P5 = S1 * T1
+  sub(m2, k2, in(x), a11, x);          // S2 = S1 - A11
+  sub(k2, n2, b22, in(y), y);          // T2 = B22 - T1
+  product(in(x), in(y), c12);          // P6 = S2 * T2
+  sub(m2, k2, a12, in(x), x);          // S4 = A12 - S2
+  product(in(x), b22, c11);            // P3 = S4 * B22
+  product(a11, b11, p1);               // P1 = A11 * B11
+  add(m2, n2, in(p1), in(c12), c12);   // U2 = P1 + P6
+  add(m2, n2, in(c12), in(c21), c21);  // U3 = U2 + P7
+  add(m2, n2, in(c12), in(c22), c12);  // U4 = U2 + P5
+  add(m2, n2, in(c21), in(c22), c22);  // C22 = U3 + P5
+  add(m2, n2, in(c12), in(c11), c12);  // C12 = U4 + P3
+  sub(k2, n2, in(y), b21, y);          // T4 = T2 - B21
+  product(a22, in(y), c11);            // P4 = A22 * T4
+  sub(m2, n2, in(c21), in(c11), c21);  // C21 = U3 - P4
+  product(a12, b21, c11);              // P2 = A12 * B21
+  add(m2, n2, in(p1), in(c11), c11);   // C11 = P1 + P2
+
+  if (k % 2 != 0)
+    gemm_strided(2 * m2, 2 * n2, size_t{1}, a.at(0, k - 1).data, a.rs, a.cs,
+                 b.at(k - 1, 0).data, b.rs, b.cs, c.data, c.rs);
+  if (n % 2 != 0)
+    classic_product(m, size_t{1}, k, a, b.at(0, n - 1), c.at(0, n - 1));
+  if (m % 2 != 0)
+    classic_product(size_t{1}, 2 * n2, k, a.at(m - 1, 0), b, c.at(m - 1, 0));
+}
+
+/// @brief Whether the product of type `T` is computed by strassen() while
+/// the mode is on. @see set_strassen_cutoff()
+template <typename T>
+inline constexpr bool strassen_supported =
+    std::is_floating_point_v<T> && std::is_same_v<accumulator_t<T>, T>;
+
+}  // namespace detail
+
+/**
+ * @brief Turns on the fast multiplication of matrices by `*`: the products
+ * of matrices of floating point, whose sides are at least 2 * `cutoff`, are
+ * computed by strassen(). The value 0, by default, turns it off. The best
+ * cutoff depends on the machine and is usually 512 - 2048.
+ *
+ * @param cutoff Minimal side of the leaves of recursion
+ */
+inline void set_strassen_cutoff(size_t cutoff) {
+  detail::strassen_cutoff_value() = cutoff;
+}
+
+/// @brief Get the cutoff of the fast multiplication, 0 if it's off.
+inline size_t strassen_cutoff() { return detail::strassen_cutoff_value(); }
+
+/**
+ * @brief Computes the product of `m` x `k` matrix `a` and `k` x `n` matrix
+ * `b` into `m` x `n` matrix `c` by the Strassen-Winograd algorithm: C = A * B.
+ * The strides are like gemm_strided(). The blocks are split while their sides
+ * are at least 2 * `cutoff`. The temporary blocks are allocated once from
+ * `resource`, e.g. the arena of the thread. If the memory isn't allocated,
+ * the product is computed by the classic kernel.
+ * @see basic_strassen.h for the bound of the error.
+ *
+ * @param cutoff   Minimal side of the leaves of recursion
+ * @param resource Memory resource of the workspace
+ */
+template <typename T>
+void strassen(size_t m, size_t n, size_t k, const T *a, size_t rsa,
+              size_t csa, const T *b, size_t rsb, size_t csb, T *c,
+              size_t ldc, size_t cutoff,
+              std::pmr::memory_resource *resource = thread_resource()) {
+  const detail::strided<const T> lhs{a, rsa, csa}, rhs{b, rsb, csb};
+  const detail::strided<T> result{c, ldc, 1};
+  const size_t elements = detail::strassen_workspace(m, n, k, cutoff);
+  T *workspace = elements != 0
+                     ? detail::allocate_elements<T>(resource, elements)
+                     : nullptr;
+  if (workspace == nullptr) {
+    detail::classic_product(m, n, k, lhs, rhs, result);
+    return;
+  }
+  detail::strassen_winograd(m, n, k, lhs, rhs, result, cutoff, workspace);
+  detail::deallocate_elements(resource, workspace, elements);
+}
+
+}  // namespace bez
+#endif
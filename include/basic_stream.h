@@ -0,0 +1,444 @@
+/**
+ * @file basic_stream.h
+ * @brief Implements the streaming of the binary files of basic_vector and
+ * basic_matrix by chunks. The next chunk is read (or the last one is written)
+ * in the background while the current chunk is processed, so the vectors and
+ * matrices larger than the memory are processed at the speed of the disk.
+ * @see basic_io.h
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_STREAM
+#define BASIC_STREAM
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <future>
+#include <string>
+
+#include "basic_expression.h"
+#include "basic_gemm.h"
+#include "basic_io.h"
+#include "basic_types.h"
+#include "basic_view.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `stream_reader`, `stream_writer` and the
+ *   out-of-core sum, element-wise operations and product.
+ * * 2026-10-14 V0.2 `stream_sum()` accumulates in `accumulator_t`.
+ */
+
+namespace bez {
+
+/// @brief Default number of elements of chunk (8 MB of `double`).
+inline constexpr size_t stream_chunk = size_t{1} << 20;
+
+/**
+ * @class stream_reader basic_stream.h
+ *
+ * @brief Reads the binary file of vector or matrix by the chunks of `chunk`
+ * elements. The chunks of matrix are the panels of whole rows. While the
+ * current chunk is processed, the next one is read in the background.
+ * @code
+ * bez::stream_reader<double> reader("huge.bez");
+ * while (reader.next()) total += reader.chunk().sum();
+ * @endcode
+ *
+ * @details The memory of two chunks is allocated. The views of chunk are
+ * valid until the next call of `next()`. If the file isn't read or has other
+ * type, `next()` returns false with the status `STATUS::BAD_FILE`.
+ *
+ * @tparam T Integral or float point number
+ */
+template <number T>
+class stream_reader {
+ private:
+  std::ifstream _File;                  // Read file
+  file_header _Header;                  // Header of file
+  size_t _Chunk{0};                     // Elements of chunk
+  size_t _Total{0};                     // Elements of file
+  size_t _Next{0};                      // First element of next chunk
+  detail::aligned_buffer<T> _Buffers[2];  // Current and next chunks
+  size_t _Offsets[2]{};                 // First elements of chunks
+  size_t _Lengths[2]{};                 // Lengths of chunks
+  size_t _Current{1};                   // Index of current chunk
+  std::future<bool> _Prefetch;          // Reading of next chunk
+  STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+ public:
+  /**
+   * @brief Opens the file and starts reading the first chunk.
+   *
+   * @param path  Path of file
+   * @param chunk Elements of chunk, rounded down to whole rows of matrix
+   */
+  explicit stream_reader(const std::string &path, size_t chunk = stream_chunk)
+      : _File(path, std::ios::binary) {
+    _File.read(reinterpret_cast<char *>(&_Header), sizeof(_Header));
+    if (!_File || !(_Header.valid<T>(1) || _Header.valid<T>(2))) {
+      _Status = STATUS::BAD_FILE;
+      return;
+    }
+    _File.seekg(static_cast<std::streamoff>(_Header.offset));
+
+    const size_t columns = std::max<size_t>(_Header.columns, 1);
+    _Chunk = _Header.rank == 2 ? std::max<size_t>(chunk / columns, 1) * columns
+                               : std::max<size_t>(chunk, 1);
+    _Total = _Header.rows * _Header.columns;
+    _Chunk = std::min(_Chunk, std::max<size_t>(_Total, 1));
+    _Buffers[0] = detail::allocate_aligned<T>(_Chunk);
+    _Buffers[1] = detail::allocate_aligned<T>(_Chunk);
+    prefetch(0);
+  }
+
+  stream_reader(const stream_reader &) = delete;
+  stream_reader &operator=(const stream_reader &) = delete;
+
+  /// @brief Waits for the reading in the background.
+  ~stream_reader() {
+    if (_Prefetch.valid()) _Prefetch.wait();
+  }
+
+  /**
+   * @brief Takes the next chunk and starts reading the following one.
+   *
+   * @return Is there the next chunk
+   */
+  bool next() {
+    if (!_Prefetch.valid()) return false;
+    if (!_Prefetch.get()) {
+      _Status = STATUS::BAD_FILE;
+      return false;
+    }
+    _Current ^= 1;
+    if (_Lengths[_Current] == 0) return false;
+    if (_Next < _Total) prefetch(_Current ^ 1);
+    return true;
+  }
+
+  /// @brief Get the elements of the current chunk.
+  vector_view<const T> chunk() const {
+    return vector_view<const T>(_Buffers[_Current].get(), _Lengths[_Current]);
+  }
+
+  /// @brief Get the rows of matrix of the current chunk.
+  matrix_view<const T> panel() const {
+    const size_t columns = _Header.columns;
+    return matrix_view<const T>(_Buffers[_Current].get(),
+                                columns ? _Lengths[_Current] / columns : 0,
+                                columns, columns);
+  }
+
+  /// @brief Get the index of the first element of the current chunk.
+  size_t offset() const { return _Offsets[_Current]; }
+
+  const file_header &header() const { return _Header; }
+
+  STATUS status() const { return _Status; }
+
+  const std::string to_string_status() const { return to_string(_Status); }
+
+ private:
+  /// @brief Starts reading the chunk from `_Next` into the buffer.
+  void prefetch(size_t buffer) {
+    _Prefetch = std::async(std::launch::async, [this, buffer] {
+      const size_t length = std::min(_Chunk, _Total - _Next);
+      _Offsets[buffer] = _Next;
+      _Lengths[buffer] = length;
+      _File.read(reinterpret_cast<char *>(_Buffers[buffer].get()),
+                 static_cast<std::streamsize>(length * sizeof(T)));
+      _Next += length;
+      return static_cast<bool>(_File);
+    });
+  }
+};
+
+/**
+ * @class stream_writer basic_stream.h
+ *
+ * @brief Writes the binary file of vector or matrix by chunks. The chunk is
+ * computed into the buffer and written in the background while the next one
+ * is computed.
+ *
+ * @details The expression of chunk is computed with one loop directly into
+ * the buffer. If the chunks go beyond the size of file or the file isn't
+ * written, the status is `STATUS::BAD_FILE`. The file is complete after
+ * `close()`, which is called by the destructor.
+ *
+ * @tparam T Integral or float point number
+ */
+template <number T>
+class stream_writer {
+ private:
+  std::ofstream _File;                    // Written file
+  file_header _Header;                    // Header of file
+  size_t _Total{0};                       // Elements of file
+  size_t _Written{0};                     // Elements of chunks
+  detail::aligned_buffer<T> _Buffers[2];  // Buffers of chunks
+  size_t _Capacity[2]{};                  // Elements of buffers
+  size_t _Current{0};                     // Index of buffer of next chunk
+  std::future<bool> _Flush;               // Writing of last chunk
+  STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+ public:
+  /**
+   * @brief Creates the file of vector and writes the header.
+   *
+   * @param path   Path of file
+   * @param length Length of vector
+   */
+  stream_writer(const std::string &path, size_t length)
+      : stream_writer(path, detail::make_header<T>(1, 1, length)) {}
+
+  /**
+   * @brief Creates the file of matrix and writes the header.
+   *
+   * @param path    Path of file
+   * @param rows    Rows of matrix
+   * @param columns Columns of matrix
+   */
+  stream_writer(const std::string &path, size_t rows, size_t columns)
+      : stream_writer(path, detail::make_header<T>(2, rows, columns)) {}
+
+  /**
+   * @brief Creates the file of the shape of `header`, e.g. of the header of
+   * the read file, and writes the header.
+   *
+   * @param path   Path of file
+   * @param header Header of vector or matrix
+   */
+  stream_writer(const std::string &path, const file_header &header)
+      : _File(path, std::ios::binary | std::ios::trunc),
+        _Header(detail::make_header<T>(header.rank, header.rows,
+                                       header.columns)) {
+    _Total = _Header.rows * _Header.columns;
+    if (!_File || !detail::write_header(_File, _Header))
+      _Status = STATUS::BAD_FILE;
+  }
+
+  stream_writer(const stream_writer &) = delete;
+  stream_writer &operator=(const stream_writer &) = delete;
+
+  ~stream_writer() { close(); }
+
+  /**
+   * @brief Computes the chunk of vector expression and writes it after the
+   * previous chunks.
+   *
+   * @param chunk Vector, view or expression
+   * @return Status of writer
+   */
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, T>
+  STATUS write(const E &chunk) {
+    const auto node = detail::as_node(chunk);
+    T *buffer = reserve(node.length());
+    if (buffer == nullptr) return _Status;
+    detail::evaluate(buffer, node, detail::assign);
+    return commit(node.length(), node.status());
+  }
+
+  /**
+   * @brief Computes the rows of matrix expression and writes them after the
+   * previous rows. The columns must be the same as of the file.
+   *
+   * @param panel Matrix, view or expression
+   * @return Status of writer
+   */
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type, T>
+  STATUS write(const E &panel) {
+    const auto node = detail::as_matrix_node(panel);
+    if (node.columns() != _Header.columns) return _Status = STATUS::BAD_FILE;
+    T *buffer = reserve(node.rows() * node.columns());
+    if (buffer == nullptr) return _Status;
+    detail::evaluate(buffer, node.columns(), node, detail::assign);
+    return commit(node.rows() * node.columns(), node.status());
+  }
+
+  /**
+   * @brief Waits for the writing of chunks and closes the file.
+   *
+   * @return `STATUS::BAD_FILE`, if not all elements are written
+   */
+  STATUS close() {
+    if (!_File.is_open()) return _Status;
+    if (_Flush.valid() && !_Flush.get()) _Status = STATUS::BAD_FILE;
+    _File.close();
+    if (_Written != _Total || !_File) _Status = STATUS::BAD_FILE;
+    return _Status;
+  }
+
+  STATUS status() const { return _Status; }
+
+  const std::string to_string_status() const { return to_string(_Status); }
+
+ private:
+  /// @brief Get the free buffer of `length` elements.
+  T *reserve(size_t length) {
+    if (_Status != STATUS::GOOD_ALLOCATOR || length > _Total - _Written) {
+      _Status = STATUS::BAD_FILE;
+      return nullptr;
+    }
+    if (_Capacity[_Current] < length) {
+      _Buffers[_Current] = detail::allocate_aligned<T>(length);
+      _Capacity[_Current] = length;
+    }
+    return _Buffers[_Current].get();
+  }
+
+  /// @brief Writes the buffer in the background after the previous chunk.
+  STATUS commit(size_t length, STATUS status) {
+    if (status == STATUS::BOUND_ARRAY) return _Status = status;
+    if (_Flush.valid() && !_Flush.get()) return _Status = STATUS::BAD_FILE;
+
+    const T *buffer = _Buffers[_Current].get();
+    _Flush = std::async(std::launch::async, [this, buffer, length] {
+      _File.write(reinterpret_cast<const char *>(buffer),
+                  static_cast<std::streamsize>(length * sizeof(T)));
+      return static_cast<bool>(_File);
+    });
+    _Written += length;
+    _Current ^= 1;
+    return _Status;
+  }
+};
+
+/**
+ * @brief Calculates the sum of elements of the file of vector or matrix by
+ * chunks. The sums of chunks are accumulated in `accumulator_t<T>`, so the
+ * numbers of reduced precision don't lose the small chunks.
+ *
+ * @param path   Path of file
+ * @param result Sum of elements
+ * @param chunk  Elements of chunk
+ * @return `STATUS::BAD_FILE`, if the file isn't read
+ */
+template <number T>
+STATUS stream_sum(const std::string &path, T &result,
+                  size_t chunk = stream_chunk) {
+  stream_reader<T> reader(path, chunk);
+  accumulator_t<T> total(0);
+  while (reader.next()) total += reader.chunk().sum();
+  if (reader.status() == STATUS::GOOD_ALLOCATOR) result = T(total);
+  return reader.status();
+}
+
+/**
+ * @brief Computes `operation(chunk)` for the chunks of the file and writes
+ * the results to the file of the same shape.
+ * @code
+ * bez::stream_transform<double>("in.bez", "out.bez",
+ *                               [](auto x) { return x * 2.0; });
+ * @endcode
+ *
+ * @param input     Path of file
+ * @param output    Path of result
+ * @param operation Expression of chunk of the same length
+ * @param chunk     Elements of chunk
+ * @return `STATUS::BAD_FILE`, if the files aren't read or written
+ */
+template <number T, typename F>
+STATUS stream_transform(const std::string &input, const std::string &output,
+                        F &&operation, size_t chunk = stream_chunk) {
+  stream_reader<T> reader(input, chunk);
+  if (reader.status() != STATUS::GOOD_ALLOCATOR) return reader.status();
+  stream_writer<T> writer(output, reader.header());
+
+  while (reader.next())
+    if (writer.write(operation(reader.chunk())) != STATUS::GOOD_ALLOCATOR)
+      return writer.status();
+  if (reader.status() != STATUS::GOOD_ALLOCATOR) return reader.status();
+  return writer.close();
+}
+
+/**
+ * @brief Computes `operation(lhs_chunk, rhs_chunk)` for the chunks of two
+ * files of the same shape, e.g. `[](auto a, auto b) { return a + b; }`.
+ * If the shapes are different, returns `STATUS::BOUND_ARRAY`.
+ * @see stream_transform()
+ */
+template <number T, typename F>
+STATUS stream_transform(const std::string &lhs, const std::string &rhs,
+                        const std::string &output, F &&operation,
+                        size_t chunk = stream_chunk) {
+  stream_reader<T> left(lhs, chunk), right(rhs, chunk);
+  if (left.status() != STATUS::GOOD_ALLOCATOR) return left.status();
+  if (right.status() != STATUS::GOOD_ALLOCATOR) return right.status();
+  if (left.header().rows != right.header().rows ||
+      left.header().columns != right.header().columns)
+    return STATUS::BOUND_ARRAY;
+  stream_writer<T> writer(output, left.header());
+
+  while (left.next() && right.next())
+    if (writer.write(operation(left.chunk(), right.chunk())) !=
+        STATUS::GOOD_ALLOCATOR)
+      return writer.status();
+  if (left.status() != STATUS::GOOD_ALLOCATOR) return left.status();
+  if (right.status() != STATUS::GOOD_ALLOCATOR) return right.status();
+  return writer.close();
+}
+
+/**
+ * @brief Computes the product of the files of matrices `lhs` (m x k) and
+ * `rhs` (k x n) into the file `output` (m x n). The panels of rows of `lhs`
+ * are multiplied by the panels of rows of `rhs` by the blocked kernel, so
+ * the memory of three panels of `chunk` elements is used. @see gemm()
+ *
+ * @details The file `rhs` is read once for each panel of `lhs`, so the large
+ * `chunk` reduces the reading. If the columns of `lhs` aren't equal to the
+ * rows of `rhs`, returns `STATUS::BOUND_ARRAY`.
+ *
+ * @param lhs    Path of first matrix
+ * @param rhs    Path of last matrix
+ * @param output Path of product
+ * @param chunk  Elements of panel
+ * @return `STATUS::BAD_FILE`, if the files aren't read or written
+ */
+template <number T>
+STATUS stream_multiply(const std::string &lhs, const std::string &rhs,
+                       const std::string &output,
+                       size_t chunk = stream_chunk) {
+  stream_reader<T> left(lhs, chunk);
+  if (left.status() != STATUS::GOOD_ALLOCATOR) return left.status();
+  const file_header &a = left.header();
+  size_t columns;
+  {
+    stream_reader<T> right(rhs, 1);
+    if (right.status() != STATUS::GOOD_ALLOCATOR) return right.status();
+    if (a.rank != 2 || right.header().rank != 2 ||
+        a.columns != right.header().rows)
+      return STATUS::BOUND_ARRAY;
+    columns = right.header().columns;
+  }
+  stream_writer<T> writer(output, a.rows, columns);
+
+  while (left.next()) {
+    const matrix_view<const T> panel = left.panel();
+    basic_matrix<T> product(panel.rows(), columns);
+    stream_reader<T> right(rhs, chunk);
+    while (right.next()) {
+      const matrix_view<const T> block = right.panel();
+      const size_t first = right.offset() / columns;
+      gemm(panel.rows(), columns, block.rows(), panel.data() + first,
+           panel.row_stride(), block.data(), block.row_stride(),
+           product.data(), product.stride());
+    }
+    if (right.status() != STATUS::GOOD_ALLOCATOR) return right.status();
+    if (writer.write(product) != STATUS::GOOD_ALLOCATOR) return writer.status();
+  }
+  if (left.status() != STATUS::GOOD_ALLOCATOR) return left.status();
+  return writer.close();
+}
+
+}  // namespace bez
+#endif
@@ -0,0 +1,345 @@
+/**
+ * @file basic_thread_pool.h
+ * @brief Implements the pool of threads which executes the large operations of
+ * basic_vector and basic_matrix in parallel. The small operations stay on the
+ * calling thread.
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_THREAD_POOL
+#define BASIC_THREAD_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the work-stealing pool and `parallel_for`.
+ * * 2026-10-14 V0.2 The results of ranges of `parallel_reduce()` are stored
+ *   in the array, so the results of `bool` don't share the bytes.
+ */
+
+namespace bez {
+
+/**
+ * @class thread_pool basic_thread_pool.h
+ *
+ * @brief Pool of threads which executes the tasks `0..count-1` of one job in
+ * parallel. The calling thread takes part in the job.
+ *
+ * @details The tasks are split into contiguous ranges, one per thread, and
+ * each thread executes its own range first. So the same thread touches the
+ * same part of the data for jobs of the same size, which keeps the memory on
+ * the NUMA node of the thread. The thread which finished its range steals the
+ * tasks from the end of the ranges of other threads. If `pin` is set, the
+ * threads are bound to the processors (only on Linux).
+ *
+ * @exception The first exception of the tasks is rethrown by `run()`.
+ */
+class thread_pool {
+ private:
+  /// @brief Tasks of one thread, aligned to exclude false sharing.
+  struct alignas(64) queue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;
+  };
+
+  std::vector<std::thread> _Workers;        // Threads except the caller
+  std::unique_ptr<queue[]> _Queues;         // Queue per thread, 0 is caller
+  size_t _Size;                             // Number of threads
+  std::mutex _Run;                          // One job at the same time
+  std::mutex _Mutex;                        // Guards the fields below
+  std::condition_variable _Wake;            // Wakes workers for the job
+  std::condition_variable _Done;            // Wakes caller on the end of job
+  const std::function<void(size_t)> *_Task{nullptr};  // Task of the job
+  size_t _Generation{0};                    // Number of the job
+  size_t _Busy{0};                          // Workers in the job
+  bool _Stop{false};                        // Pool is destroyed
+  std::exception_ptr _Error;                // First exception of the job
+
+  static inline thread_local bool _Inside = false;  // Thread runs a task
+
+ public:
+  /**
+   * @brief Starts `size - 1` threads.
+   *
+   * @param size Number of threads together with the caller
+   * @param pin  Bind the threads to the processors
+   */
+  explicit thread_pool(size_t size, bool pin = false)
+      : _Queues(new queue[std::max<size_t>(size, 1)]),
+        _Size(std::max<size_t>(size, 1)) {
+    for (size_t index = 1; index < _Size; index++) {
+      _Workers.emplace_back([this, index] { work(index); });
+#if defined(__linux__)
+      if (pin) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(index % std::max(1u, std::thread::hardware_concurrency()),
+                &set);
+        pthread_setaffinity_np(_Workers.back().native_handle(), sizeof(set),
+                               &set);
+      }
+#else
+      (void)pin;
+#endif
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  /// @brief Stops the threads.
+  ~thread_pool() {
+    {
+      std::lock_guard lock(_Mutex);
+      _Stop = true;
+    }
+    _Wake.notify_all();
+    for (auto &worker : _Workers) worker.join();
+  }
+
+  /// @brief Get the number of threads together with the caller.
+  size_t size() const { return _Size; }
+
+  /// @brief Is the current thread executing the task of a pool.
+  static bool inside() { return _Inside; }
+
+  /**
+   * @brief Executes `task(i)` for each i in [0, count) and waits for the end.
+   * Called from the task, executes the tasks on the current thread.
+   *
+   * @param count Number of tasks
+   * @param task  Task
+   */
+  void run(size_t count, const std::function<void(size_t)> &task) {
+    if (count == 0) return;
+    if (_Size == 1 || count == 1 || _Inside) {
+      for (size_t i = 0; i < count; i++) task(i);
+      return;
+    }
+
+    std::lock_guard run_lock(_Run);
+    for (size_t index = 0; index < _Size; index++) {
+      std::lock_guard lock(_Queues[index].mutex);
+      for (size_t i = count * index / _Size; i < count * (index + 1) / _Size;
+           i++)
+        _Queues[index].tasks.push_back(i);
+    }
+    {
+      std::lock_guard lock(_Mutex);
+      _Task = &task;
+      _Error = nullptr;
+      _Busy = _Workers.size();
+      _Generation++;
+    }
+    _Wake.notify_all();
+
+    execute(0, task);
+
+    std::unique_lock lock(_Mutex);
+    _Done.wait(lock, [this] { return _Busy == 0; });
+    _Task = nullptr;
+    if (_Error) std::rethrow_exception(_Error);
+  }
+
+ private:
+  /// @brief Takes the task of the own queue, otherwise steals it.
+  bool take(size_t index, size_t &task) {
+    {
+      std::lock_guard lock(_Queues[index].mutex);
+      if (!_Queues[index].tasks.empty()) {
+        task = _Queues[index].tasks.front();
+        _Queues[index].tasks.pop_front();
+        return true;
+      }
+    }
+    for (size_t offset = 1; offset < _Size; offset++) {
+      queue &victim = _Queues[(index + offset) % _Size];
+      std::lock_guard lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        task = victim.tasks.back();
+        victim.tasks.pop_back();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// @brief Executes the tasks until all queues are empty.
+  void execute(size_t index, const std::function<void(size_t)> &task) {
+    _Inside = true;
+    size_t i;
+    while (take(index, i)) {
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard lock(_Mutex);
+        if (!_Error) _Error = std::current_exception();
+      }
+    }
+    _Inside = false;
+  }
+
+  /// @brief Loop of the worker thread.
+  void work(size_t index) {
+    size_t generation = 0;
+    for (;;) {
+      const std::function<void(size_t)> *task;
+      {
+        std::unique_lock lock(_Mutex);
+        _Wake.wait(lock,
+                   [&] { return _Stop || _Generation != generation; });
+        if (_Stop) return;
+        generation = _Generation;
+        task = _Task;
+      }
+
+      execute(index, *task);
+
+      std::lock_guard lock(_Mutex);
+      if (--_Busy == 0) _Done.notify_one();
+    }
+  }
+};
+
+namespace detail {
+
+inline std::unique_ptr<thread_pool> &pool_instance() {
+  static std::unique_ptr<thread_pool> pool;
+  return pool;
+}
+
+inline std::atomic<size_t> &parallel_threshold_value() {
+  static std::atomic<size_t> threshold{size_t{1} << 16};
+  return threshold;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Get the pool of the library. By default it has
+ * `std::thread::hardware_concurrency()` threads.
+ *
+ * @return Pool of threads
+ */
+inline thread_pool &default_pool() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    if (!detail::pool_instance())
+      detail::pool_instance() = std::make_unique<thread_pool>(
+          std::max(1u, std::thread::hardware_concurrency()));
+  });
+  return *detail::pool_instance();
+}
+
+/**
+ * @brief Replaces the pool of the library. Must not be called while the
+ * operations of the library are executed. With `threads` = 1 all operations
+ * are serial.
+ *
+ * @param threads Number of threads
+ * @param pin     Bind the threads to the processors
+ */
+inline void set_num_threads(size_t threads, bool pin = false) {
+  default_pool();
+  detail::pool_instance() = std::make_unique<thread_pool>(threads, pin);
+}
+
+/// @brief Get the number of threads of the pool of the library.
+inline size_t num_threads() { return default_pool().size(); }
+
+/**
+ * @brief Set the minimal number of elements (or multiply-add operations for
+ * the product of matrices divided by 64) which are processed in parallel.
+ *
+ * @param elements Minimal number of elements
+ */
+inline void set_parallel_threshold(size_t elements) {
+  detail::parallel_threshold_value() = elements;
+}
+
+/// @brief Get the minimal number of elements which are processed in parallel.
+inline size_t parallel_threshold() {
+  return detail::parallel_threshold_value();
+}
+
+/**
+ * @brief Calls `function(begin, end)` for the ranges of [0, count) of `grain`
+ * elements. If count * weight < `parallel_threshold()`, calls
+ * `function(0, count)`. Otherwise the ranges are executed by the pool of the
+ * library.
+ *
+ * @param count    Number of elements
+ * @param grain    Elements of one range
+ * @param function Function of range
+ * @param weight   Work of one element, e.g. the columns of the row
+ */
+template <typename F>
+void parallel_for(size_t count, size_t grain, F &&function, size_t weight = 1) {
+  if (count * weight < parallel_threshold() || thread_pool::inside()) {
+    function(size_t{0}, count);
+    return;
+  }
+  grain = std::max<size_t>(grain, 1);
+  const size_t tasks = (count + grain - 1) / grain;
+  default_pool().run(tasks, [&](size_t task) {
+    function(task * grain, std::min(count, (task + 1) * grain));
+  });
+}
+
+/**
+ * @brief Reduces [0, count) by `function(begin, end)` of ranges of `grain`
+ * elements and combines the results of ranges in their order by `combine`.
+ * The ranges don't depend on the number of threads, so the result is the
+ * same for any pool.
+ *
+ * @param count    Number of elements
+ * @param grain    Elements of one range
+ * @param init     Initial value
+ * @param function Reduction of range
+ * @param combine  Combination of two results
+ * @return Result of the reduction
+ */
+template <typename R, typename F, typename C>
+R parallel_reduce(size_t count, size_t grain, R init, F &&function,
+                  C &&combine) {
+  if (count < parallel_threshold() || thread_pool::inside())
+    return combine(init, function(size_t{0}, count));
+
+  grain = std::max<size_t>(grain, 1);
+  const size_t tasks = (count + grain - 1) / grain;
+  // The results are written concurrently, so they are the separate objects
+  // unlike the bits of `std::vector<bool>`
+  std::unique_ptr<R[]> partial(new R[tasks]());
+  default_pool().run(tasks, [&](size_t task) {
+    partial[task] = function(task * grain, std::min(count, (task + 1) * grain));
+  });
+  for (size_t task = 0; task < tasks; task++)
+    init = combine(init, partial[task]);
+  return init;
+}
+
+}  // namespace bez
+#endif
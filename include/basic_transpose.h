@@ -0,0 +1,191 @@
+/**
+ * @file basic_transpose.h
+ * @brief Implements the kernels of transposition of matrices in row-major
+ * order: out of place by the cache-oblivious tiles, and in place by the swaps
+ * of tiles for square matrices or by the cycles of permutation for
+ * rectangular matrices.
+ * @code
+ * bez::basic_matrix<double> t = bez::transpose(a);  // New matrix
+ * a.transpose_in_place();                          // Same memory
+ * @endcode
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_TRANSPOSE
+#define BASIC_TRANSPOSE
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "basic_memory.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tiled and the in-place transposition.
+ */
+
+namespace bez::detail {
+
+/// @brief Side of the tile, which is transposed by the fixed loops. The rows
+/// of the source and the destination of tile fit in the registers.
+template <typename T>
+inline constexpr size_t transpose_tile = std::max<size_t>(4, 32 / sizeof(T));
+
+/// @brief Elements of the block, which fits in L1 cache with its transposed
+/// copy.
+inline constexpr size_t transpose_block = 32 * 32;
+
+/**
+ * @brief Transposes the tile of `N` x `N` elements: dst(j, i) = src(i, j).
+ * The fixed bounds let the compiler keep the tile in the vector registers and
+ * transpose it by the shuffles.
+ */
+template <typename T, size_t N>
+inline void transpose_kernel(const T *src, size_t lds, T *dst, size_t ldd) {
+  T tile[N][N];
+  for (size_t i = 0; i < N; i++)
+    for (size_t j = 0; j < N; j++) tile[j][i] = src[i * lds + j];
+  for (size_t j = 0; j < N; j++)
+    for (size_t i = 0; i < N; i++) dst[j * ldd + i] = tile[j][i];
+}
+
+/**
+ * @brief Transposes `rows` x `columns` block: dst(j, i) = src(i, j). The
+ * larger side is halved until the block fits in L1 cache, so the block of
+ * any level of cache is transposed inside the cache.
+ *
+ * @param src     Source in row-major order
+ * @param lds     Leading dimension of `src`
+ * @param dst     Destination of `columns` x `rows` elements
+ * @param ldd     Leading dimension of `dst`
+ */
+template <typename T>
+void transpose_copy(const T *src, size_t lds, T *dst, size_t ldd, size_t rows,
+                    size_t columns) {
+  if (rows * columns > transpose_block && rows > 1 && columns > 1) {
+    if (rows >= columns) {
+      const size_t half = rows / 2;
+      transpose_copy(src, lds, dst, ldd, half, columns);
+      transpose_copy(src + half * lds, lds, dst + half, ldd, rows - half,
+                     columns);
+    } else {
+      const size_t half = columns / 2;
+      transpose_copy(src, lds, dst, ldd, rows, half);
+      transpose_copy(src + half, lds, dst + half * ldd, ldd, rows,
+                     columns - half);
+    }
+    return;
+  }
+
+  constexpr size_t N = transpose_tile<T>;
+  const size_t full_rows = rows / N * N, full_columns = columns / N * N;
+  for (size_t i = 0; i < full_rows; i += N)
+    for (size_t j = 0; j < full_columns; j += N)
+      transpose_kernel<T, N>(src + i * lds + j, lds, dst + j * ldd + i, ldd);
+  for (size_t i = 0; i < rows; i++) {
+    const size_t first = i < full_rows ? full_columns : 0;
+    for (size_t j = first; j < columns; j++)
+      dst[j * ldd + i] = src[i * lds + j];
+  }
+}
+
+/**
+ * @brief Transposes `rows` x `columns` matrix into `columns` x `rows` matrix
+ * in parallel by the block columns of the source. @see transpose_copy()
+ */
+template <typename T>
+void transpose_parallel(const T *src, size_t lds, T *dst, size_t ldd,
+                        size_t rows, size_t columns) {
+  constexpr size_t grain = 64;
+  parallel_for(
+      (columns + grain - 1) / grain, 1,
+      [&](size_t begin, size_t end) {
+        const size_t first = begin * grain;
+        const size_t last = std::min(columns, end * grain);
+        transpose_copy(src + first, lds, dst + first * ldd, ldd, rows,
+                       last - first);
+      },
+      grain * rows);
+}
+
+/**
+ * @brief Transposes `n` x `n` matrix in place. The tiles above the diagonal
+ * are swapped with the transposed tiles below it through the buffer.
+ */
+template <typename T>
+void transpose_square(T *data, size_t ld, size_t n) {
+  BEZ_STATS_OPERATION(expression, n * n, 0);
+  constexpr size_t N = transpose_tile<T>;
+  const size_t tiles = (n + N - 1) / N;
+  parallel_for(
+      tiles, 1,
+      [&](size_t begin, size_t end) {
+        T upper[N * N], lower[N * N];
+        for (size_t ti = begin; ti < end; ti++) {
+          const size_t i = ti * N, rows = std::min(N, n - i);
+          // The diagonal tile
+          for (size_t r = 0; r < rows; r++)
+            for (size_t c = r + 1; c < rows; c++)
+              std::swap(data[(i + r) * ld + i + c], data[(i + c) * ld + i + r]);
+
+          for (size_t j = i + N; j < n; j += N) {
+            const size_t columns = std::min(N, n - j);
+            if (rows == N && columns == N) {
+              transpose_kernel<T, N>(data + i * ld + j, ld, upper, N);
+              transpose_kernel<T, N>(data + j * ld + i, ld, lower, N);
+              for (size_t r = 0; r < N; r++) {
+                std::copy(upper + r * N, upper + r * N + N,
+                          data + (j + r) * ld + i);
+                std::copy(lower + r * N, lower + r * N + N,
+                          data + (i + r) * ld + j);
+              }
+            } else {
+              for (size_t r = 0; r < rows; r++)
+                for (size_t c = 0; c < columns; c++)
+                  std::swap(data[(i + r) * ld + j + c],
+                            data[(j + c) * ld + i + r]);
+            }
+          }
+        }
+      },
+      n * N);
+}
+
+/**
+ * @brief Transposes `rows` x `columns` contiguous matrix in place by the
+ * cycles of permutation: the element `k` moves to `k % columns * rows + k /
+ * columns`. The visited elements are marked in `rows * columns` bits.
+ */
+template <typename T>
+void transpose_cycles(T *data, size_t rows, size_t columns) {
+  BEZ_STATS_OPERATION(expression, rows * columns, 0);
+  const size_t size = rows * columns;
+  if (rows <= 1 || columns <= 1) return;
+  std::pmr::vector<bool> visited(size, false, thread_resource());
+  // The first and the last elements don't move
+  for (size_t start = 1; start + 1 < size; start++) {
+    if (visited[start]) continue;
+    size_t k = start;
+    T value = data[start];
+    do {
+      k = k % columns * rows + k / columns;
+      std::swap(value, data[k]);
+      visited[k] = true;
+    } while (k != start);
+  }
+}
+
+}  // namespace bez::detail
+#endif
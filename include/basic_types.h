@@ -0,0 +1,140 @@
+/**
+ * @file basic_types.h
+ * @brief Defines the error status and the concepts of element types, which are
+ * common for basic_vector and basic_matrix.
+ *
+ * @version 0.8
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_TYPES
+#define BASIC_TYPES
+
+#include <concepts>
+#include <cstddef>
+#include <string>
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Moved `STATUS` and the concepts from basic_vector.h.
+ * * 2026-10-14 V0.2 Added `dynamic_extent`.
+ * * 2026-10-14 V0.3 Added `STATUS::BAD_FILE`.
+ * * 2026-10-14 V0.4 Added `sparse_format`.
+ * * 2026-10-14 V0.5 Added `STATUS::SINGULAR`.
+ * * 2026-10-14 V0.6 `number` admits the numbers of reduced precision.
+ *   @see basic_precision.h
+ * * 2026-10-14 V0.7 Added `summation`.
+ * * 2026-10-14 V0.8 Added `BEZ_CHECKED`.
+ */
+
+/**
+ * The access operators `[]` and `()` of vectors, matrices and views check the
+ * indexes and take the error status `STATUS::BOUND_ARRAY`. With
+ * `BEZ_CHECKED=0` the checks are compiled out, and the operators are the
+ * same as `at()`, which never checks the indexes. The kernels of the library
+ * use `data()`, `begin()` and `end()` in any mode.
+ */
+#ifndef BEZ_CHECKED
+#define BEZ_CHECKED 1
+#endif
+
+namespace bez {
+
+/**
+ * @enum @class STATUS
+ *
+ * @brief Possible errors when executing program. If they aren't, define status
+ * as `GOOD_ALLOCATOR`.
+ *
+ * @details If an error occurs while executing the program, the program doesn't
+ * end, and the status assigns a variable.
+ *
+ */
+enum class STATUS {
+  BAD_ALLOCATOR,    // Not enough memory or bad allocate
+  BOUND_ARRAY,      // Beyond the array or segmentation fault
+  BAD_INITIALIZED,  // Initialization with a negative number for unsigned type
+  GOOD_ALLOCATOR,   // Successful allocate and initialization
+  DIVIDED_ZERO,     // Divide to zero
+  BAD_FILE,         // File isn't opened, or its format or type is wrong
+  SINGULAR          // Matrix is singular or isn't positive definite
+};
+
+/**
+ * @brief Get the name of error status.
+ *
+ * @param status Error status
+ * @return Name of error status
+ */
+inline const std::string to_string(STATUS status) {
+  switch (status) {
+    case STATUS::BAD_ALLOCATOR:
+      return "BAD_ALLOCATOR";
+    case STATUS::BOUND_ARRAY:
+      return "BOUND_ARRAY";
+    case STATUS::BAD_INITIALIZED:
+      return "BAD_INITALIZED";
+    case STATUS::DIVIDED_ZERO:
+      return "DIVIDED_ZERO";
+    case STATUS::BAD_FILE:
+      return "BAD_FILE";
+    case STATUS::SINGULAR:
+      return "SINGULAR";
+    default:
+      return "GOOD_ALLOCATOR";
+  }
+}
+
+template <typename T>
+concept arithmetic = std::integral<T> || std::floating_point<T>;
+
+template <typename T>
+concept character = std::same_as<T, char> || std::same_as<T, signed char> ||
+                    std::same_as<T, unsigned char> ||
+                    std::same_as<T, wchar_t> || std::same_as<T, char8_t> ||
+                    std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+class float16;
+class bfloat16;
+class int8;
+
+/// @brief Numbers of reduced precision, which are stored in 1 or 2 bytes and
+/// computed in the wider type. @see basic_precision.h
+template <typename T>
+concept reduced_precision = std::same_as<T, float16> ||
+                            std::same_as<T, bfloat16> || std::same_as<T, int8>;
+
+template <typename T>
+concept number = (arithmetic<T> && !character<T>) || reduced_precision<T>;
+
+/// @brief Size of vector or matrix which is known only at run time.
+inline constexpr size_t dynamic_extent = static_cast<size_t>(-1);
+
+/**
+ * @enum @class sparse_format
+ *
+ * @brief Order of the stored elements of sparse matrix.
+ */
+enum class sparse_format {
+  csr,  // Compressed rows: the elements are stored row by row
+  csc   // Compressed columns: the elements are stored column by column
+};
+
+/**
+ * @enum @class summation
+ *
+ * @brief Strategy of summation of float point numbers. The integers are
+ * summed exactly by all strategies.
+ */
+enum class summation {
+  fast,      // Independent accumulators of vector registers
+  pairwise,  // Halves are summed recursively, the error grows as log(n)
+  kahan      // Compensated by Neumaier, the error doesn't grow with n
+};
+}  // namespace bez
+#endif
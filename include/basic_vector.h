@@ -3,7 +3,7 @@
  * @brief Implements the functionally for basic_vector. It's implemented on the
  * basis of dynamic memory.
  *
- * @version 0.4
+ * @version 0.22
  *
  * @date 17:51 2020-10-07
  * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
@@ -16,8 +16,23 @@
 #define BASIC_VECTOR
 
 #include <algorithm>
+#include <cmath>
 #include <concepts>
 #include <fstream>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "basic_expression.h"
+#include "basic_memory.h"
+#include "basic_reduce.h"
+#include "basic_simd.h"
+#include "basic_stats.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+#include "basic_view.h"
 
 /* Changes ----------------------------------------------------------
  * ===================================================================
@@ -31,8 +46,56 @@
  * * 2020-10-10 V0.3.2 Added opeartion /, /=. Added `STATUS::DIVIDED_ZERO` which
  *   defines when Vector divided to zero.
  * * 2020-10-10 V0.4 Added concept check for non-character type.
+ * * 2026-10-14 V0.5 Added move constructor and move operation `=`.
+ * * 2026-10-14 V0.6 Operations `+`, `-`, `*`, `/` return the expressions
+ *   which are computed on assignment. @see basic_expression.h
+ * * 2026-10-14 V0.7 `sum()`, `*=`, `/=`, `+=`, `-=` use the vectorized kernels.
+ *   Added `dot()`, `min()`, `max()`, `norm()`. @see basic_simd.h
+ * * 2026-10-14 V0.8 Long vectors are processed in parallel.
+ *   @see basic_thread_pool.h
+ * * 2026-10-14 V0.9 The memory is taken from the polymorphic memory resource.
+ *   @see basic_memory.h
+ * * 2026-10-14 V0.10 Added the constructor of uninitialized vector. The memory
+ *   is aligned to the cache line.
+ * * 2026-10-14 V0.11 basic_vector<T> is the specialization of the vector of
+ *   dynamic length. @see basic_fixed.h
+ * * 2026-10-14 V0.12 Short vectors are stored inside the object.
+ * * 2026-10-14 V0.13 Added `view()` and `slice()`. @see basic_view.h
+ * * 2026-10-14 V0.14 Added the constructor of vector of external memory.
+ *   @see basic_io.h
+ * * 2026-10-14 V0.15 `==` compares the elements in the same order in linear
+ *   time. Added `multiset_equal()` for the comparison in any order.
+ * * 2026-10-14 V0.16 Copies, temporaries and operations are counted by the
+ *   statistics. @see basic_stats.h
+ * * 2026-10-14 V0.17 `ngen` is the counter sharded between the threads, which
+ *   can be compiled out. @see sharded_counter
+ * * 2026-10-14 V0.18 The product of sparse matrix and vector sets the status.
+ *   @see basic_sparse.h
+ * * 2026-10-14 V0.19 `sum()` and `dot()` accumulate in `accumulator_t`.
+ *   @see basic_precision.h
+ * * 2026-10-14 V0.20 `sum()` takes the strategy of summation. @see summation
+ * * 2026-10-14 V0.21 `[]` checks the index only if `BEZ_CHECKED`. Added
+ *   `begin()` and `end()`.
+ * * 2026-10-14 V0.22 `=` of the expression of other length computes it before
+ *   the memory is freed.
  */
 
+/**
+ * Counts the existing vectors in `basic_vector<T>::ngen`. With
+ * `BEZ_COUNT_INSTANCES=0` the counting is compiled out and `ngen` is zero.
+ */
+#ifndef BEZ_COUNT_INSTANCES
+#define BEZ_COUNT_INSTANCES 1
+#endif
+
+/**
+ * Number of elements which are stored inside basic_vector without allocating
+ * the memory. Longer vectors take the memory of the resource.
+ */
+#ifndef BEZ_VECTOR_INLINE_CAPACITY
+#define BEZ_VECTOR_INLINE_CAPACITY 16
+#endif
+
 /** TODO ----------------------------------------------------------
  * ===================================================================
  * Add an exception for defines status when execute the next operation.
@@ -40,35 +103,21 @@
 
 namespace bez {
 
-/**
- * @enum @class STATUS
- *
- * @brief Possible errors when executing program. If they aren't, define status
- * as `GOOD_ALLOCATOR`.
- *
- * @details If an error occurs while executing the program, the program doesn't
- * end, and the status assigns a variable.
- *
- */
-enum class STATUS {
-  BAD_ALLOCATOR,    // Not enough memory or bad allocate
-  BOUND_ARRAY,      // Beyond the array or segmentation fault
-  BAD_INITIALIZED,  // Initialization with a negative number for unsigned type
-  GOOD_ALLOCATOR,   // Successful allocate and initialization
-  DIVIDED_ZERO      // Divide to zero
+namespace detail {
+
+#if BEZ_COUNT_INSTANCES
+using instance_counter = sharded_counter;
+#else
+/// @brief Counter of vectors when the counting is compiled out.
+struct instance_counter {
+  void increment() noexcept {}
+  void decrement() noexcept {}
+  int64_t value() const noexcept { return 0; }
+  void reset() noexcept {}
 };
+#endif
 
-template <typename T>
-concept arithmetic = std::integral<T> || std::floating_point<T>;
-
-template <typename T>
-concept character = std::same_as<T, char> || std::same_as<T, signed char> ||
-                    std::same_as<T, unsigned char> ||
-                    std::same_as<T, wchar_t> || std::same_as<T, char8_t> ||
-                    std::same_as<T, char16_t> || std::same_as<T, char32_t>;
-
-template <typename T>
-concept number = arithmetic<T> && !character<T>;
+}  // namespace detail
 
 /**
  * @class basic_vector basic_vector.h
@@ -87,7 +136,13 @@ concept number = arithmetic<T> && !character<T>;
  * as `STATUS::BOUND_ARRAY`. Define the errro status as `STATUS::DIVIDED_ZERO`
  * which as `STATUS::BOUND_ARRAY`. Define the errro status as
  * `STATUS::DIVIDED_ZERO` when Vector divided to zero. Contains a
- * static field `ngen`, which determines the number of existing vectors.
+ * static field `ngen`, which determines the number of existing vectors
+ * (`ngen.value()`). It's sharded between the threads, so the vectors are
+ * constructed on many threads without the data race.
+ * The memory is taken from the memory resource given on construction, by
+ * default from `thread_resource()` of the current thread. The vector keeps
+ * its resource on assignment. The vectors of at most `inline_capacity`
+ * elements are stored inside the object and don't allocate the memory.
  *
  * @exception No exception for defines status when
  * executed after indexing and after initialized vector by negative value to
@@ -96,36 +151,67 @@ concept number = arithmetic<T> && !character<T>;
  * @tparam T Integral or float point number
  */
 template <number T>
-class basic_vector {
+class basic_vector<T, dynamic_extent> {
  protected:
   // Types:
-  size_t _Length;  // Length of vector
-  T *_Allocator;   // Pointer to allocated memory
+  size_t _Length;           // Length of vector
+  T *_Allocator{nullptr};   // Pointer to allocated memory or `_Inline`
   mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+  std::pmr::memory_resource *_Resource;            // Source of memory
+
+ public:
+  using value_type = T;
+
+  /// @brief Maximal length of vector stored inside the object.
+  static constexpr size_t inline_capacity = BEZ_VECTOR_INLINE_CAPACITY;
+
+ protected:
+  T _Inline[inline_capacity > 0 ? inline_capacity : 1];  // Short vector
 
  public:
+
   /// @brief Allocates memory for one element and initializes it to zero.
-  basic_vector() : _Length(1) {
-    ngen++;
-    _Allocator = new T[1];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      _Allocator[0] = 0;
-  }
+  basic_vector() : basic_vector(1) {}
 
   /**
    * @brief Allocates memory of size `length` and initializes the array to zero.
    *
+   * @param length   Size of vector
+   * @param resource Source of memory. @see thread_resource()
+   */
+  basic_vector(size_t length,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    ngen.increment();
+    if (allocate(length)) std::fill(_Allocator, _Allocator + _Length, T(0));
+  }
+
+  /**
+   * @brief Allocates memory of size `length` without initializing the
+   * elements. @see uninitialized_t
+   *
+   * @param length   Size of vector
+   * @param resource Source of memory
+   */
+  basic_vector(size_t length, uninitialized_t,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    ngen.increment();
+    allocate(length);
+  }
+
+  /**
+   * @brief Refers to `length` elements of the external memory without
+   * copying. @see external_t
+   *
+   * @param data   Elements of vector
    * @param length Size of vector
    */
-  basic_vector(size_t length) : _Length(length) {
-    ngen++;
-    _Allocator = new T[length];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t i = 0; i < length; i++) _Allocator[i] = 0;
+  basic_vector(T *data, size_t length, external_t)
+      : _Length(length),
+        _Allocator(data),
+        _Resource(std::pmr::null_memory_resource()) {
+    ngen.increment();
   }
 
   /**
@@ -138,83 +224,125 @@ class basic_vector {
    *
    * @param length             Size of vector
    * @param initializedValue   Value to initializate
+   * @param resource           Source of memory
    */
-  basic_vector(size_t length,
-               long initializedValue) requires(std::unsigned_integral<T>)
-      : _Length(length) {
-    ngen++;
+  basic_vector(size_t length, long initializedValue,
+               std::pmr::memory_resource *resource =
+                   thread_resource()) requires(std::unsigned_integral<T>)
+      : _Length(length), _Resource(resource) {
+    ngen.increment();
     if (initializedValue < 0)
       _Status = STATUS::BAD_INITIALIZED;
-    else {
-      _Allocator = new T[length];
-      if (_Allocator == nullptr)
-        _Status = STATUS::BAD_ALLOCATOR;
-      else
-        for (size_t i = 0; i < length; i++)
-          _Allocator[i] = static_cast<T>(initializedValue);
-    }
+    else if (allocate(length))
+      std::fill(_Allocator, _Allocator + _Length,
+                static_cast<T>(initializedValue));
   }
 
   /// @exception Used only for non-unsigned type
-  basic_vector(size_t length,
-               T initializedValue) requires(!std::unsigned_integral<T>)
-      : _Length(length) {
-    ngen++;
+  basic_vector(size_t length, T initializedValue,
+               std::pmr::memory_resource *resource =
+                   thread_resource()) requires(!std::unsigned_integral<T>)
+      : _Resource(resource) {
+    ngen.increment();
+    if (allocate(length))
+      std::fill(_Allocator, _Allocator + _Length, initializedValue);
+  }
 
-    _Allocator = new T[length];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t i = 0; i < length; i++) _Allocator[i] = initializedValue;
+  /**
+   * @brief Copy. The memory is taken from the `resource`, not from the
+   * resource of the `other`.
+   *
+   * @param other    Initialized vector
+   * @param resource Source of memory
+   */
+  basic_vector(const basic_vector<T> &other,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Resource(resource) {
+    ngen.increment();
+    BEZ_STATS_COPY();
+    if (allocate(other._Length))
+      std::copy(other._Allocator, other._Allocator + _Length, _Allocator);
   }
 
   /**
-   * @brief Copy
+   * @brief Move. Takes the allocated memory and the resource of the `other`,
+   * which is left empty with the length 0. The short vector is copied.
    *
    * @param other Initialized vector
    */
-  basic_vector(const basic_vector<T> &other) {
-    ngen++;
-    _Length = other.length();
-    _Allocator = new T[_Length];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t i = 0; i < _Length; i++) _Allocator[i] = other._Allocator[i];
+  basic_vector(basic_vector<T> &&other) noexcept
+      : _Length(other._Length),
+        _Allocator(other._Allocator),
+        _Status(other._Status),
+        _Resource(other._Resource) {
+    ngen.increment();
+    if (other.is_inline()) {
+      _Allocator = _Inline;
+      std::copy(other._Inline, other._Inline + _Length, _Inline);
+    }
+    other._Length = 0;
+    other._Allocator = nullptr;
+  }
+
+  /**
+   * @brief Computes the expression of vectors with one loop. Takes the status
+   * of the expression. @see basic_expression.h
+   *
+   * @param expression Node of expression
+   * @param resource   Source of memory
+   */
+  template <vector_operand E>
+    requires(!detail::is_basic_vector<E>::value &&
+             std::same_as<typename E::value_type, T>)
+  basic_vector(const E &expression,
+               std::pmr::memory_resource *resource = thread_resource())
+      : _Status(expression.status()), _Resource(resource) {
+    ngen.increment();
+    BEZ_STATS_TEMPORARY();
+    if (allocate(expression.length()))
+      detail::evaluate(_Allocator, expression, detail::assign);
   }
 
   /// @brief Frees the allocated dynamic memory, if it is allocated.
   ~basic_vector() {
-    if (_Allocator != nullptr) delete[] _Allocator;
-    ngen--;
+    release();
+    ngen.decrement();
   }
 
   /**
-   * @brief Overload operation `[]` like indexing of the vector.
+   * @brief Overload operation `[]` like indexing of the vector. If the index
+   * goes beyond the vector, returns the last element with the error status
+   * `STATUS::BOUND_ARRAY`. With `BEZ_CHECKED=0` it's the same as `at()`.
    *
    * @param index Index of element
    * @return Element
    */
   constexpr T &operator[](const size_t index) {
-    if (index >= 0 && index < _Length) return _Allocator[index];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Length - 1];
+    if (BEZ_CHECKED && index >= _Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Allocator[_Length - 1];
+    }
+    return _Allocator[index];
   }
 
   /**
    * @brief Overload operation `[]` like returns value of the element.
+   * @see operator[]()
    *
    * @param index Index of element
    * @return Value of element
    */
   constexpr const T &operator[](const size_t index) const {
-    if (index >= 0 && index < _Length) return _Allocator[index];
-    _Status = STATUS::BOUND_ARRAY;
-    return _Allocator[_Length - 1];
+    if (BEZ_CHECKED && index >= _Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Allocator[_Length - 1];
+    }
+    return _Allocator[index];
   }
 
   /**
    * @brief Overload operation `=`. If it is self-assignment, retuns this.
+   * Reuses the own memory, if the length is the same.
    *
    * @param other Initialized vector
    * @return Vector
@@ -222,25 +350,66 @@ class basic_vector {
   basic_vector<T> &operator=(const basic_vector<T> &other) {
     if (this == &other) return *this;
 
-    // Frees memory, if it's allocated
-    if (_Allocator != nullptr) delete[] _Allocator;
+    BEZ_STATS_COPY();
+    if (_Length != other._Length || _Allocator == nullptr) {
+      release();
+      if (!allocate(other._Length)) return *this;
+    }
+    std::copy(other._Allocator, other._Allocator + _Length, _Allocator);
+    return *this;
+  }
 
-    _Length = other.length();
-    _Allocator = new T[_Length];
-    if (_Allocator == nullptr)
-      _Status = STATUS::BAD_ALLOCATOR;
-    else
-      for (size_t i = 0; i < _Length; i++) _Allocator[i] = other[i];
+  /**
+   * @brief Overload operation `=` like move. Frees the own memory and takes the
+   * memory of the `other`. If it is self-assignment, retuns this. If the
+   * `other` is short or the resources aren't equal, copies the elements to the
+   * own memory, since the vector keeps its resource.
+   *
+   * @param other Initialized vector
+   * @return Vector
+   */
+  basic_vector<T> &operator=(basic_vector<T> &&other) noexcept {
+    if (this == &other) return *this;
+
+    if (other.is_inline() || !_Resource->is_equal(*other._Resource))
+      return *this = other;
+
+    release();
+
+    _Length = std::exchange(other._Length, 0);
+    _Allocator = std::exchange(other._Allocator, nullptr);
+    _Status = other._Status;
+    return *this;
+  }
+
+  /**
+   * @brief Overload operation `=` for the expression of vectors. Computes the
+   * expression with one loop and takes its status. @see basic_expression.h
+   *
+   * @param expression Node of expression
+   * @return Vector
+   */
+  template <vector_operand E>
+    requires(!detail::is_basic_vector<E>::value &&
+             std::same_as<typename E::value_type, T>)
+  basic_vector<T> &operator=(const E &expression) {
+    // The expression of other length may read this memory, e.g.
+    // `v = v.slice(1, 3)`, so it's computed before the memory is freed
+    if (_Length != expression.length())
+      return *this = basic_vector<T>(expression, _Resource);
+
+    _Status = expression.status();
+    detail::evaluate(_Allocator, expression, detail::assign);
     return *this;
   }
 
   friend std::ostream &operator<<(std::ostream &os, basic_vector<T> &obj) {
-    for (size_t i = 0; i < obj.length(); i++) os << obj[i] << ' ';
+    for (const T &element : obj) os << element << ' ';
     return os;
   }
 
   friend std::istream &operator>>(std::istream &is, basic_vector<T> &obj) {
-    for (size_t i = 0; i < obj.length(); i++) is >> obj[i];
+    for (T &element : obj) is >> element;
     return is;
   }
 
@@ -281,6 +450,52 @@ class basic_vector {
    */
   constexpr T &at(const size_t index) { return _Allocator[index]; }
 
+  /**
+   * @brief Get the pointer to the elements of vector.
+   *
+   * @return Pointer to the first element
+   */
+  constexpr T *data() { return _Allocator; }
+
+  /// @see constexpr T *data();
+  constexpr const T *data() const { return _Allocator; }
+
+  /// @brief Get the iterators of elements, which are the pointers.
+  constexpr T *begin() { return _Allocator; }
+  constexpr T *end() { return _Allocator + _Length; }
+  constexpr const T *begin() const { return _Allocator; }
+  constexpr const T *end() const { return _Allocator + _Length; }
+
+  /// @brief Get the resource which the memory of vector is taken from.
+  std::pmr::memory_resource *resource() const { return _Resource; }
+
+  /// @brief Get the view of all elements. @see vector_view
+  vector_view<T> view() { return vector_view<T>(_Allocator, _Length); }
+
+  /// @see vector_view<T> view();
+  vector_view<const T> view() const {
+    return vector_view<const T>(_Allocator, _Length);
+  }
+
+  /**
+   * @brief Get the view of `length` elements from `begin` with the `step`
+   * without copying. @see vector_view::slice()
+   *
+   * @param begin  Index of first element
+   * @param length Length of range
+   * @param step   Distance between elements of range
+   * @return View of range
+   */
+  vector_view<T> slice(size_t begin, size_t length, size_t step = 1) {
+    return view().slice(begin, length, step);
+  }
+
+  /// @see vector_view<T> slice(size_t begin, size_t length, size_t step);
+  vector_view<const T> slice(size_t begin, size_t length,
+                             size_t step = 1) const {
+    return view().slice(begin, length, step);
+  }
+
   /**
    * @brief Get the length of vector
    *
@@ -289,171 +504,200 @@ class basic_vector {
   constexpr size_t length() const { return _Length; }
 
   /**
-   * @brief Calculates the sum of all elements of the vector.
+   * @brief Calculates the sum of all elements of the vector. The numbers of
+   * reduced precision are summed in `accumulator_t<T>`.
    *
+   * @param mode Strategy of summation: `pairwise` or `kahan` keep the error
+   * of long float point vectors small. @see summation
    * @return Sum of elements
    */
-  T sum() const {
-    T total = 0;
-    for (size_t i = 0; i < _Length; i++) total += _Allocator[i];
-    return total;
+  accumulator_t<T> sum(summation mode = summation::fast) const {
+    BEZ_STATS_OPERATION(sum, _Length, _Length);
+    return detail::parallel_sum(_Allocator, _Length, mode);
   }
 
   /**
-   * @brief Get the status of error
+   * @brief Calculates the scalar product of vectors. If the lengths are
+   * different, it returns 0 with the error status `STATUS::BOUND_ARRAY`. The
+   * product is accumulated in `accumulator_t<T>`.
    *
-   * @return Error status
+   * @param other Vector
+   * @return Scalar product
    */
-  STATUS status() { return _Status; }
+  accumulator_t<T> dot(const basic_vector<T> &other) const {
+    if (_Length != other._Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
+    }
+    BEZ_STATS_OPERATION(dot, _Length, 2 * _Length);
+    return parallel_reduce(
+        _Length, detail::evaluate_grain, accumulator_t<T>(0),
+        [&](size_t begin, size_t end) {
+          return simd::dot(_Allocator + begin, other._Allocator + begin,
+                           end - begin);
+        },
+        std::plus<accumulator_t<T>>());
+  }
+
+  /// @brief Calculates the scalar product with the view or the expression.
+  /// @see vector_view::dot()
+  template <vector_operand E>
+    requires(!detail::is_basic_vector<E>::value &&
+             std::same_as<typename detail::node_t<E>::value_type, T>)
+  accumulator_t<T> dot(const E &other) const {
+    const vector_view<const T> self = view();
+    const accumulator_t<T> result = self.dot(other);
+    if (self.status() != STATUS::GOOD_ALLOCATOR) _Status = self.status();
+    return result;
+  }
 
   /**
-   * @brief Get the name of error
+   * @brief Calculates the minimum of elements. If the vector is empty, it
+   * returns 0 with the error status `STATUS::BOUND_ARRAY`.
    *
-   * @return Name of error status
+   * @return Minimum of elements
    */
-  const std::string to_string_status() {
-    switch (_Status) {
-      case STATUS::BAD_ALLOCATOR:
-        return "BAD_ALLOCATOR";
-      case STATUS::BOUND_ARRAY:
-        return "BOUND_ARRAY";
-      case STATUS::BAD_INITIALIZED:
-        return "BAD_INITALIZED";
-      case STATUS::DIVIDED_ZERO:
-        return "DIVIDED_ZERO";
-      default:
-        return "GOOD_ALLOCATOR";
+  T min() const {
+    if (_Length == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
     }
+    BEZ_STATS_OPERATION(min, _Length, _Length);
+    return parallel_reduce(
+        _Length, detail::evaluate_grain, _Allocator[0],
+        [this](size_t begin, size_t end) {
+          return simd::min(_Allocator + begin, end - begin);
+        },
+        [](T lhs, T rhs) { return std::min(lhs, rhs); });
+  }
+
+  /// @brief Calculates the maximum of elements. @see min()
+  T max() const {
+    if (_Length == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
+    }
+    BEZ_STATS_OPERATION(min, _Length, _Length);
+    return parallel_reduce(
+        _Length, detail::evaluate_grain, _Allocator[0],
+        [this](size_t begin, size_t end) {
+          return simd::max(_Allocator + begin, end - begin);
+        },
+        [](T lhs, T rhs) { return std::max(lhs, rhs); });
   }
 
   /**
-   * @brief Increase each element by a `k` value.
-   * @details If k = 1, then returns this.
+   * @brief Calculates the Euclidean norm of vector. The norm of vector of
+   * integral type is `double`.
    *
-   * @param other Initialized vector
-   * @param k Coefficient to increase
-   * @return Vector with magnified elements
+   * @return Square root of the scalar product of vector to itself
    */
-  friend basic_vector<T> operator*(const basic_vector<T> &other, const T k) {
-    basic_vector<T> vec(other);
-    if (k == 1) return vec;
-    for (size_t i = 0; i < vec.length(); i++) vec[i] = other[i] * k;
-    return vec;
-  }
-
-  /// @brief Perform the same operation as `*`.
-  /// @see ` basic_vector<T> operator*()`
-  basic_vector<T> &operator*=(const T k) {
-    if (k == 1) return *this;
-    for (size_t i = 0; i < _Length; i++) _Allocator[i] *= k;
-    return *this;
+  auto norm() const {
+    using result_type = std::conditional_t<std::floating_point<T>, T, double>;
+    return static_cast<result_type>(
+        std::sqrt(static_cast<result_type>(dot(*this))));
   }
 
   /**
-   * @brief Decrease each element by a `k` value.
+   * @brief Get the status of error
    *
-   * @details If k = 0, then returns this with `STATUS::DIVIDED_ZERO`.
+   * @return Error status
+   */
+  STATUS status() { return _Status; }
+
+  /**
+   * @brief Get the name of error
    *
-   * @param other Initialized vector
-   * @param k Coefficient to decrease
-   * @return Vector
+   * @return Name of error status
    */
-  friend basic_vector<T> operator/(const basic_vector<T> &other, const T k) {
-    basic_vector<T> vec(other);
-    if (k == 0) {
-      vec.setStatus(STATUS::DIVIDED_ZERO);
-      return vec;
-    }
+  const std::string to_string_status() { return to_string(_Status); }
 
-    for (size_t i = 0; i < vec.length(); i++) vec[i] = other[i] / k;
-    return vec;
+  /// @brief Perform the same operation as `*` in place.
+  /// @see `operator*()` in basic_expression.h
+  basic_vector<T> &operator*=(const T k) {
+    if (k == 1) return *this;
+    BEZ_STATS_OPERATION(scale, _Length, _Length);
+    parallel_for(_Length, detail::evaluate_grain,
+                 [&](size_t begin, size_t end) {
+                   simd::mul(_Allocator + begin, k, _Allocator + begin,
+                             end - begin);
+                 });
+    return *this;
   }
 
-  /// @brief Perfom the same operation as `/`.
-  /// @see `basic_vector<T> operator/()`
+  /// @brief Perfom the same operation as `/` in place.
+  /// @see `operator/()` in basic_expression.h
   basic_vector<T> &operator/=(const T k) {
     if (k == 0) {
       _Status = STATUS::DIVIDED_ZERO;
       return *this;
     }
-    for (size_t i = 0; i < _Length; i++) _Allocator[i] /= k;
+    BEZ_STATS_OPERATION(scale, _Length, _Length);
+    parallel_for(_Length, detail::evaluate_grain,
+                 [&](size_t begin, size_t end) {
+                   simd::div(_Allocator + begin, k, _Allocator + begin,
+                             end - begin);
+                 });
     return *this;
   }
 
-  /**
-   * @brief Calculate the sum of vectors. If the vectors are of different
-   * lengths, it returns vector of zeros with the error status
-   * `STATUS::BOUND_ARRAY`.
-   *
-   * @param lhs First vector
-   * @param rhs Last vector
-   *
-   * @return Sum of vectors
-   */
-  friend basic_vector<T> operator+(const basic_vector<T> &lhs,
-                                   const basic_vector<T> &rhs) {
-    basic_vector<T> vec(lhs.length());
-    if (lhs.length() != rhs.length()) {
-      vec._Status = STATUS::BOUND_ARRAY;
-      return vec;
-    }
-
-    for (size_t i = 0; i < lhs.length(); i++) vec[i] = lhs[i] + rhs[i];
-
-    return vec;
-  }
-
   /**
    * @brief Perfom the same operations as `+`. IF the lengths are different, it
-   * returns `this`. @see `basic_vector<T> +operator()`
+   * returns `this`. The expression is computed in the same loop.
+   * @see `operator+()` in basic_expression.h
    *
-   * @param other Initialized vector
+   * @param other Vector or expression of vectors
    * @return Sum of vectors
    */
-  basic_vector<T> &operator+=(const basic_vector<T> &other) {
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, T>
+  basic_vector<T> &operator+=(const E &other) {
     if (_Length != other.length()) return *this;
 
-    for (size_t i = 0; i < _Length; i++) _Allocator[i] += other[i];
-    return *this;
-  }
-
-  /**
-   * @brief Return the different of vectors. If the lengths are different, it
-   * returns a vector of zeros with the error status `STATUS::BOUND_ARRAY`.
-   *
-   * @param lhs First vector
-   * @param rhs Last vector
-   * @return The difference of vectors
-   */
-  friend basic_vector<T> operator-(const basic_vector<T> &lhs,
-                                   const basic_vector<T> &rhs) {
-    basic_vector<T> vec(lhs.length());
-    if (lhs.length() != rhs.length()) {
-      vec._Status = STATUS::BOUND_ARRAY;
-      return vec;
+    if constexpr (detail::is_basic_vector<E>::value) {
+      BEZ_STATS_OPERATION(expression, _Length, _Length);
+      parallel_for(_Length, detail::evaluate_grain,
+                   [&](size_t begin, size_t end) {
+                     simd::add(_Allocator + begin, other.data() + begin,
+                               _Allocator + begin, end - begin);
+                   });
+    } else {
+      detail::evaluate(_Allocator, detail::as_node(other), detail::plus_assign);
     }
-
-    for (size_t i = 0; i < lhs.length(); i++) vec[i] = lhs[i] - rhs[i];
-    return vec;
+    return *this;
   }
 
   /**
    * @brief Perfoms the same operation as `-`. If the vectors are of different
-   * lengths, returns this. @see `basic_vector<T> -operator()`
+   * lengths, returns this. @see `operator-()` in basic_expression.h
    *
-   * @param other Initialized vector
+   * @param other Vector or expression of vectors
    * @return The difference of vectors
    */
-  basic_vector<T> &operator-=(const basic_vector<T> &other) {
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, T>
+  basic_vector<T> &operator-=(const E &other) {
     if (_Length != other.length()) return *this;
 
-    for (size_t i = 0; i < _Length; i++) _Allocator[i] -= other[i];
+    if constexpr (detail::is_basic_vector<E>::value) {
+      BEZ_STATS_OPERATION(expression, _Length, _Length);
+      parallel_for(_Length, detail::evaluate_grain,
+                   [&](size_t begin, size_t end) {
+                     simd::sub(_Allocator + begin, other.data() + begin,
+                               _Allocator + begin, end - begin);
+                   });
+    } else {
+      detail::evaluate(_Allocator, detail::as_node(other),
+                       detail::minus_assign);
+    }
     return *this;
   }
 
   /**
-   * @brief If the lengths are different, it returns false. Otherwise sorts the
-   * vectors and compares each element.
+   * @brief If the lengths are different, it returns false. Otherwise compares
+   * the elements in the same order and stops on the first different one.
+   * The vectors with the same elements in other order aren't equal.
+   * @see multiset_equal()
    *
    * @param lhs First vector
    * @param rhs Last vector
@@ -463,15 +707,8 @@ class basic_vector {
                          const basic_vector<T> &rhs) {
     if (lhs.length() != rhs.length()) return false;
 
-    basic_vector<T> t1 = lhs, t2 = rhs;
-
-    std::sort(t1._Allocator, t1._Allocator + t1.length());
-    std::sort(t2._Allocator, t2._Allocator + t2.length());
-
-    for (size_t i = 0; i < lhs.length(); i++)
-      if (t1[i] != t2[i]) return false;
-
-    return true;
+    BEZ_STATS_OPERATION(equal, lhs.length(), lhs.length());
+    return simd::equal(lhs._Allocator, rhs._Allocator, lhs.length());
   }
 
   /**
@@ -541,11 +778,143 @@ class basic_vector {
     return !(lhs < rhs);
   }
 
+ protected:
+  /**
+   * @brief Allocates memory of `length` elements of `_Resource`, or takes
+   * `_Inline` for the short vector. The elements aren't initialized.
+   *
+   * @param length Length of vector
+   * @return Is the memory allocated
+   */
+  bool allocate(size_t length) noexcept {
+    _Length = length;
+    _Allocator = length <= inline_capacity
+                     ? _Inline
+                     : detail::allocate_elements<T>(_Resource, length);
+    if (_Allocator == nullptr) {
+      _Length = 0;
+      _Status = STATUS::BAD_ALLOCATOR;
+      return false;
+    }
+    return true;
+  }
+
+  /// @brief Frees the allocated memory, if it is allocated.
+  void release() noexcept {
+    if (!is_inline())
+      detail::deallocate_elements(_Resource, _Allocator, _Length);
+    _Allocator = nullptr;
+  }
+
+  /// @brief Is the vector stored inside the object.
+  bool is_inline() const noexcept { return _Allocator == _Inline; }
+
  public:
-  static size_t ngen;  // Number of existing vectors
+  static inline detail::instance_counter ngen;  // Number of existing vectors
+
+  template <number U, sparse_format F>
+  friend class basic_sparse_matrix;
 };
 
-template <number T>
-size_t basic_vector<T>::ngen = 0;
+namespace detail {
+
+/// @brief At least one of operands is the expression of vectors.
+template <typename L, typename R>
+concept vector_expression_pair =
+    vector_operand<L> && vector_operand<R> && same_value<L, R> &&
+    !(is_basic_vector<L>::value && is_basic_vector<R>::value);
+
+}  // namespace detail
+
+/**
+ * @brief Comparisons of the expressions of vectors. The expressions are
+ * compared like basic_vector. The equality computes the elements one by one
+ * without the temporary vectors and stops on the first different one; other
+ * comparisons compute the expressions into the temporary vectors.
+ * @see basic_vector
+ */
+template <typename L, typename R>
+  requires detail::vector_expression_pair<L, R>
+bool operator==(const L &lhs, const R &rhs) {
+  using T = typename detail::node_t<L>::value_type;
+  const auto first = detail::as_node(lhs);
+  const auto last = detail::as_node(rhs);
+  if (first.length() != last.length()) return false;
+
+  if (first.status() == STATUS::BOUND_ARRAY ||
+      last.status() == STATUS::BOUND_ARRAY) {
+    const basic_vector<T> &left = lhs, &right = rhs;
+    return left == right;
+  }
+
+  const T *left = detail::contiguous_data(first);
+  const T *right = detail::contiguous_data(last);
+  if (left != nullptr && right != nullptr)
+    return simd::equal(left, right, first.length());
+
+  for (size_t i = 0; i < first.length(); i++)
+    if (first.element(i) != last.element(i)) return false;
+  return true;
+}
+
+template <typename L, typename R>
+  requires detail::vector_expression_pair<L, R>
+bool operator<(const L &lhs, const R &rhs) {
+  return lhs.sum() < rhs.sum();
+}
+
+template <typename L, typename R>
+  requires detail::vector_expression_pair<L, R>
+bool operator>(const L &lhs, const R &rhs) {
+  return rhs < lhs;
+}
+
+template <typename L, typename R>
+  requires detail::vector_expression_pair<L, R>
+bool operator<=(const L &lhs, const R &rhs) {
+  return !(rhs < lhs);
+}
+
+template <typename L, typename R>
+  requires detail::vector_expression_pair<L, R>
+bool operator>=(const L &lhs, const R &rhs) {
+  return !(lhs < rhs);
+}
+/**
+ * @brief Checks that two vectors have the same elements in any order, i.e.
+ * each value is repeated the same number of times. The vectors, views and
+ * expressions of the same type of elements can be compared.
+ * @code
+ * bez::multiset_equal(a, b);  // {1, 2, 2} and {2, 1, 2} are true
+ * @endcode
+ *
+ * @details The numbers of repetitions are counted in the hash table in the
+ * memory of `thread_resource()`, so the check takes linear time. If the
+ * elements are in the same order, the table isn't built. `NaN` isn't equal
+ * to any element, and `-0.0` is equal to `0.0`.
+ *
+ * @param lhs First vector
+ * @param rhs Last vector
+ * @return Are the vectors equal as the multisets
+ */
+template <vector_operand L, vector_operand R>
+  requires detail::same_value<L, R>
+bool multiset_equal(const L &lhs, const R &rhs) {
+  using T = typename detail::node_t<L>::value_type;
+  if (lhs.length() != rhs.length()) return false;
+  if (lhs == rhs) return true;
+
+  const basic_vector<T> &first = lhs, &last = rhs;
+  std::pmr::unordered_map<T, size_t> counts(thread_resource());
+  counts.reserve(first.length());
+  for (size_t i = 0; i < first.length(); i++) counts[first[i]]++;
+  for (size_t i = 0; i < last.length(); i++) {
+    const auto count = counts.find(last[i]);
+    if (count == counts.end() || count->second == 0) return false;
+    count->second--;
+  }
+  return true;
+}
+
 }  // namespace bez
 #endif
\ No newline at end of file
@@ -0,0 +1,625 @@
+/**
+ * @file basic_view.h
+ * @brief Implements the views of basic_vector and basic_matrix, which refer to
+ * the part of elements without copying: the row, the column, the strided
+ * range, the block and the transposed matrix. The views are the operands of
+ * the expressions. @see basic_expression.h
+ *
+ * @version 0.7
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BASIC_VIEW
+#define BASIC_VIEW
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+#include "basic_expression.h"
+#include "basic_memory.h"
+#include "basic_reduce.h"
+#include "basic_simd.h"
+#include "basic_thread_pool.h"
+#include "basic_types.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement `vector_view` and `matrix_view`.
+ * * 2026-10-14 V0.2 `sum()` and `dot()` accumulate in `accumulator_t`.
+ * * 2026-10-14 V0.3 `sum()` takes the strategy of summation. @see summation
+ * * 2026-10-14 V0.4 `[]` and `()` check the indexes only if `BEZ_CHECKED`.
+ *   `at()` of matrix_view doesn't check them.
+ * * 2026-10-14 V0.5 The expressions assigned to matrix_view, which read it by
+ *   another layout, e.g. `m.transpose() = m`, are computed into the temporary.
+ * * 2026-10-14 V0.6 The same for the expressions assigned to vector_view.
+ * * 2026-10-14 V0.7 `sum()` of the strided views gathers the elements into
+ *   `scratch`, so it works for `bool`.
+ */
+
+namespace bez {
+
+namespace detail {
+
+/**
+ * @brief Get the pointer to the elements of the node of vector, if they are
+ * contiguous. Otherwise `nullptr`.
+ */
+template <typename E>
+constexpr const typename E::value_type *contiguous_data(const E &node) {
+  if constexpr (requires { node.stride(); })
+    return node.stride() == 1 ? node.data() : nullptr;
+  else if constexpr (requires { node.data(); })
+    return node.data();
+  else
+    return nullptr;
+}
+
+/**
+ * @brief Computes the vector expression into the elements `dst[i * stride]`.
+ * The expression, which reads `dst` by another layout, is computed into the
+ * temporary. @see evaluate(), aliases()
+ *
+ * @return `false` if the temporary of aliased expression isn't allocated
+ */
+template <typename T, typename E, typename Op>
+bool evaluate_strided(T *dst, size_t stride, const E &expression, Op op) {
+  if (aliases<T>(expression, dst, stride))
+    return evaluate_temporary_vector<T>(expression, [&](const auto &node) {
+      evaluate_strided(dst, stride, node, op);
+    });
+  if (stride == 1) {
+    evaluate(dst, expression, op);
+    return true;
+  }
+
+  const bool guarded = expression.status() == STATUS::BOUND_ARRAY;
+  parallel_for(expression.length(), evaluate_grain,
+               [&](size_t begin, size_t end) {
+                 if (guarded)
+                   for (size_t i = begin; i < end; i++)
+                     op(dst[i * stride], expression.guarded(i));
+                 else
+                   for (size_t i = begin; i < end; i++)
+                     op(dst[i * stride], expression.element(i));
+               });
+  return true;
+}
+
+/**
+ * @brief Computes the matrix expression into the elements
+ * `dst[row * row_stride + column * column_stride]`. The expression, which
+ * reads `dst` by another layout, is computed into the temporary.
+ * @see evaluate(), aliases()
+ *
+ * @return `false` if the temporary of aliased expression isn't allocated
+ */
+template <typename T, typename E, typename Op>
+bool evaluate_strided(T *dst, size_t row_stride, size_t column_stride,
+                      const E &expression, Op op) {
+  if (column_stride == 1) return evaluate(dst, row_stride, expression, op);
+  if (aliases<T>(expression, dst, row_stride, column_stride))
+    return evaluate_temporary<T>(expression, [&](const auto &node) {
+      evaluate_strided(dst, row_stride, column_stride, node, op);
+    });
+
+  const size_t columns = expression.columns();
+  const bool guarded = expression.status() == STATUS::BOUND_ARRAY;
+  const size_t grain = std::max<size_t>(1, evaluate_grain / (columns + 1));
+  parallel_for(
+      expression.rows(), grain,
+      [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; row++) {
+          T *line = dst + row * row_stride;
+          if (guarded)
+            for (size_t col = 0; col < columns; col++)
+              op(line[col * column_stride], expression.guarded(row, col));
+          else
+            for (size_t col = 0; col < columns; col++)
+              op(line[col * column_stride], expression.element(row, col));
+        }
+      },
+      columns);
+  return true;
+}
+
+}  // namespace detail
+
+/**
+ * @class vector_view basic_view.h
+ *
+ * @brief Vector of `length` elements `data[i * stride]`, which refers to the
+ * memory of vector or matrix. The view doesn't own the memory and must not
+ * live longer than the vector or the matrix.
+ *
+ * @details The copy of view refers to the same elements. The assignment of
+ * the vector, the view or the expression to the view writes the elements,
+ * so `matrix.row(0) = matrix.row(1)` copies the row. If the lengths are
+ * different, the elements aren't written and the view has the error status
+ * `STATUS::BOUND_ARRAY`. The expression, which reads the elements of the
+ * view by another layout, e.g. `v.slice(1, n) = v.slice(0, n)`, is computed
+ * into the temporary first.
+ *
+ * @tparam T Integral or float point number, `const` for the read-only view
+ */
+template <typename T>
+class vector_view : public vector_expression<vector_view<T>> {
+ public:
+  using value_type = std::remove_const_t<T>;
+
+ private:
+  T *_Data;        // First element
+  size_t _Length;  // Length of view
+  size_t _Stride;  // Distance between elements
+  mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+  template <typename>
+  friend class matrix_view;
+
+ public:
+  /**
+   * @brief Refers to `length` elements `data[i * stride]`.
+   *
+   * @param data   First element
+   * @param length Length of view
+   * @param stride Distance between elements
+   */
+  constexpr vector_view(T *data, size_t length, size_t stride = 1)
+      : _Data(data), _Length(length), _Stride(stride) {}
+
+  /// @brief Read-only view of the same elements.
+  template <typename U>
+    requires(std::is_const_v<T> && std::same_as<const U, T>)
+  constexpr vector_view(const vector_view<U> &other)
+      : _Data(other.data()), _Length(other.length()), _Stride(other.stride()) {}
+
+  constexpr vector_view(const vector_view &other) = default;
+
+  /// @brief Copies the elements of the `other`. @see vector_view
+  vector_view &operator=(const vector_view &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::assign);
+  }
+
+  /// @brief Computes the expression into the elements. @see vector_view
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, value_type>
+  vector_view &operator=(const E &expression)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(expression, detail::assign);
+  }
+
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, value_type>
+  vector_view &operator+=(const E &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::plus_assign);
+  }
+
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, value_type>
+  vector_view &operator-=(const E &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::minus_assign);
+  }
+
+  vector_view &operator*=(const value_type k)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(*this * k, detail::assign);
+  }
+
+  /// @brief If k = 0, the elements aren't changed with `STATUS::DIVIDED_ZERO`.
+  vector_view &operator/=(const value_type k)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(*this / k, detail::assign);
+  }
+
+  /**
+   * @brief Overload operation `[]` like indexing of basic_vector.
+   * @see basic_vector::operator[]()
+   *
+   * @param index Index of element
+   * @return Element
+   */
+  constexpr T &operator[](const size_t index) const {
+    if (BEZ_CHECKED && index >= _Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Data[(_Length - 1) * _Stride];
+    }
+    return _Data[index * _Stride];
+  }
+
+  /// @brief Get the element without checking the index.
+  constexpr T &at(const size_t index) const { return _Data[index * _Stride]; }
+
+  constexpr T *data() const { return _Data; }
+  constexpr size_t length() const { return _Length; }
+  constexpr size_t stride() const { return _Stride; }
+  constexpr STATUS status() const { return _Status; }
+  const std::string to_string_status() const { return to_string(_Status); }
+
+  constexpr value_type element(size_t index) const {
+    return _Data[index * _Stride];
+  }
+
+  constexpr value_type guarded(size_t index) const {
+    return _Data[index * _Stride];
+  }
+
+  /**
+   * @brief Get the view of `length` elements from `begin` with the `step`. If
+   * the range goes beyond the view, returns the empty view with the error
+   * status `STATUS::BOUND_ARRAY`.
+   *
+   * @param begin  Index of first element
+   * @param length Length of range
+   * @param step   Distance between elements of range
+   * @return View of range
+   */
+  constexpr vector_view slice(size_t begin, size_t length,
+                              size_t step = 1) const {
+    if (length != 0 && (begin >= _Length || step == 0 ||
+                        (length - 1) > (_Length - 1 - begin) / step)) {
+      vector_view view(_Data, 0, _Stride);
+      view._Status = STATUS::BOUND_ARRAY;
+      return view;
+    }
+    return vector_view(_Data + begin * _Stride, length, _Stride * step);
+  }
+
+  /// @brief Calculates the sum of elements in `accumulator_t<value_type>`
+  /// by the strategy `mode`. @see summation
+  accumulator_t<value_type> sum(summation mode = summation::fast) const {
+    using wide_type = accumulator_t<value_type>;
+    if (_Stride == 1) return detail::parallel_sum(_Data, _Length, mode);
+    if (mode == summation::fast) {
+      wide_type total = 0;
+      for (size_t i = 0; i < _Length; i++)
+        total += static_cast<wide_type>(_Data[i * _Stride]);
+      return total;
+    }
+    // The elements are gathered, so they are summed by the kernels
+    detail::scratch<wide_type> line(_Length);
+    for (size_t i = 0; i < _Length; i++)
+      line[i] = static_cast<wide_type>(_Data[i * _Stride]);
+    return simd::sum(line.data(), _Length, mode);
+  }
+
+  /**
+   * @brief Calculates the scalar product with the vector, the view or the
+   * expression. If the lengths are different, it returns 0 with the error
+   * status `STATUS::BOUND_ARRAY`.
+   *
+   * @param other Vector
+   * @return Scalar product
+   */
+  template <vector_operand E>
+    requires std::same_as<typename detail::node_t<E>::value_type, value_type>
+  accumulator_t<value_type> dot(const E &other) const {
+    using wide_type = accumulator_t<value_type>;
+    const auto node = detail::as_node(other);
+    if (node.length() != _Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
+    }
+
+    const value_type *contiguous = detail::contiguous_data(node);
+    if (_Stride == 1 && contiguous != nullptr)
+      return parallel_reduce(
+          _Length, detail::evaluate_grain, wide_type(0),
+          [&](size_t begin, size_t end) {
+            return simd::dot(_Data + begin, contiguous + begin, end - begin);
+          },
+          std::plus<wide_type>());
+
+    wide_type total = 0;
+    for (size_t i = 0; i < _Length; i++)
+      total += static_cast<wide_type>(_Data[i * _Stride]) *
+               static_cast<wide_type>(node.element(i));
+    return total;
+  }
+
+  /**
+   * @brief Calculates the minimum of elements. If the view is empty, it
+   * returns 0 with the error status `STATUS::BOUND_ARRAY`.
+   */
+  value_type min() const {
+    return reduce(
+        [](const value_type *data, size_t n) { return simd::min(data, n); },
+        [](value_type lhs, value_type rhs) { return std::min(lhs, rhs); });
+  }
+
+  /// @brief Calculates the maximum of elements. @see min()
+  value_type max() const {
+    return reduce(
+        [](const value_type *data, size_t n) { return simd::max(data, n); },
+        [](value_type lhs, value_type rhs) { return std::max(lhs, rhs); });
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const vector_view &obj) {
+    for (size_t i = 0; i < obj._Length; i++) os << obj.at(i) << ' ';
+    return os;
+  }
+
+  /// @brief Calculates the Euclidean norm. @see basic_vector::norm()
+  auto norm() const {
+    using result_type =
+        std::conditional_t<std::floating_point<value_type>, value_type, double>;
+    return static_cast<result_type>(
+        std::sqrt(static_cast<result_type>(dot(*this))));
+  }
+
+ private:
+  /// @brief Computes `op(element, value)` for the elements of expression.
+  template <typename E, typename Op>
+  vector_view &assign(const E &expression, Op op) {
+    const auto node = detail::as_node(expression);
+    if (node.length() != _Length) {
+      _Status = STATUS::BOUND_ARRAY;
+      return *this;
+    }
+    if constexpr (std::is_same_v<Op, detail::assign_op>)
+      _Status = node.status();
+    if (!detail::evaluate_strided(_Data, _Stride, node, op))
+      _Status = STATUS::BAD_ALLOCATOR;
+    return *this;
+  }
+
+  /// @brief Reduces the elements by the kernel of contiguous elements and
+  /// the combination of two elements.
+  template <typename K, typename C>
+  value_type reduce(K &&kernel, C &&combine) const {
+    if (_Length == 0) {
+      _Status = STATUS::BOUND_ARRAY;
+      return 0;
+    }
+    if (_Stride == 1)
+      return parallel_reduce(
+          _Length, detail::evaluate_grain, _Data[0],
+          [&](size_t begin, size_t end) {
+            return kernel(_Data + begin, end - begin);
+          },
+          combine);
+    value_type result = _Data[0];
+    for (size_t i = 1; i < _Length; i++)
+      result = combine(result, _Data[i * _Stride]);
+    return result;
+  }
+};
+
+/**
+ * @class matrix_view basic_view.h
+ *
+ * @brief Matrix `rows` x `columns` of elements
+ * `data[row * row_stride + column * column_stride]`, which refers to the
+ * memory of matrix. Like `std::mdspan` with the strided layout, the view can
+ * refer to the block or to the transposed matrix.
+ *
+ * @details The copy and the assignment are like of vector_view. If the shapes
+ * are different, the elements aren't written and the view has the error
+ * status `STATUS::BOUND_ARRAY`. @see vector_view
+ *
+ * @tparam T Integral or float point number, `const` for the read-only view
+ */
+template <typename T>
+class matrix_view : public matrix_expression<matrix_view<T>> {
+ public:
+  using value_type = std::remove_const_t<T>;
+
+ private:
+  T *_Data;               // First element
+  size_t _Rows;           // Rows of view
+  size_t _Columns;        // Columns of view
+  size_t _RowStride;      // Distance between rows
+  size_t _ColumnStride;   // Distance between columns
+  mutable STATUS _Status{STATUS::GOOD_ALLOCATOR};  // Error status
+
+ public:
+  /**
+   * @brief Refers to the elements `data[row * row_stride + column *
+   * column_stride]`.
+   *
+   * @param data          First element
+   * @param rows          Rows of view
+   * @param columns       Columns of view
+   * @param row_stride    Distance between rows
+   * @param column_stride Distance between columns
+   */
+  constexpr matrix_view(T *data, size_t rows, size_t columns,
+                        size_t row_stride, size_t column_stride = 1)
+      : _Data(data),
+        _Rows(rows),
+        _Columns(columns),
+        _RowStride(row_stride),
+        _ColumnStride(column_stride) {}
+
+  /// @brief Read-only view of the same elements.
+  template <typename U>
+    requires(std::is_const_v<T> && std::same_as<const U, T>)
+  constexpr matrix_view(const matrix_view<U> &other)
+      : _Data(other.data()),
+        _Rows(other.rows()),
+        _Columns(other.columns()),
+        _RowStride(other.row_stride()),
+        _ColumnStride(other.column_stride()) {}
+
+  constexpr matrix_view(const matrix_view &other) = default;
+
+  /// @brief Copies the elements of the `other`. @see matrix_view
+  matrix_view &operator=(const matrix_view &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::assign);
+  }
+
+  /// @brief Computes the expression into the elements. @see matrix_view
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type,
+                          value_type>
+  matrix_view &operator=(const E &expression)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(expression, detail::assign);
+  }
+
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type,
+                          value_type>
+  matrix_view &operator+=(const E &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::plus_assign);
+  }
+
+  template <matrix_operand E>
+    requires std::same_as<typename detail::matrix_node_t<E>::value_type,
+                          value_type>
+  matrix_view &operator-=(const E &other)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(other, detail::minus_assign);
+  }
+
+  /// @brief If k = 0, the elements aren't changed with `STATUS::DIVIDED_ZERO`.
+  matrix_view &operator/=(const value_type k)
+    requires(!std::is_const_v<T>)
+  {
+    return assign(*this / k, detail::assign);
+  }
+
+  /**
+   * @brief Get the element. If the indexes go beyond the view, returns the
+   * last element with the error status `STATUS::BOUND_ARRAY`. With
+   * `BEZ_CHECKED=0` it's the same as `at()`.
+   *
+   * @param row     Index of row
+   * @param column  Index of column
+   * @return Element
+   */
+  constexpr T &operator()(const size_t row, const size_t column) const {
+    if (BEZ_CHECKED && (row >= _Rows || column >= _Columns)) {
+      _Status = STATUS::BOUND_ARRAY;
+      return _Data[(_Rows - 1) * _RowStride + (_Columns - 1) * _ColumnStride];
+    }
+    return _Data[row * _RowStride + column * _ColumnStride];
+  }
+
+  /// @brief Get the element without checking the indexes.
+  constexpr T &at(const size_t row, const size_t column) const {
+    return _Data[row * _RowStride + column * _ColumnStride];
+  }
+
+  constexpr T *data() const { return _Data; }
+  constexpr size_t rows() const { return _Rows; }
+  constexpr size_t columns() const { return _Columns; }
+  constexpr size_t row_stride() const { return _RowStride; }
+  constexpr size_t column_stride() const { return _ColumnStride; }
+  constexpr STATUS status() const { return _Status; }
+  const std::string to_string_status() const { return to_string(_Status); }
+
+  constexpr value_type element(size_t row, size_t column) const {
+    return _Data[row * _RowStride + column * _ColumnStride];
+  }
+
+  constexpr value_type guarded(size_t row, size_t column) const {
+    return _Data[row * _RowStride + column * _ColumnStride];
+  }
+
+  /**
+   * @brief Get the view of row. If the index goes beyond the view, returns the
+   * empty view with the error status `STATUS::BOUND_ARRAY`.
+   */
+  constexpr vector_view<T> row(size_t row) const {
+    if (row >= _Rows) return empty_vector();
+    return vector_view<T>(_Data + row * _RowStride, _Columns, _ColumnStride);
+  }
+
+  /// @brief Get the view of column. @see row()
+  constexpr vector_view<T> col(size_t column) const {
+    if (column >= _Columns) return empty_vector();
+    return vector_view<T>(_Data + column * _ColumnStride, _Rows, _RowStride);
+  }
+
+  /**
+   * @brief Get the view of block `rows` x `columns` from the element (`row`,
+   * `column`). If the block goes beyond the view, returns the empty view with
+   * the error status `STATUS::BOUND_ARRAY`.
+   */
+  constexpr matrix_view block(size_t row, size_t column, size_t rows,
+                              size_t columns) const {
+    if (row > _Rows || column > _Columns || rows > _Rows - row ||
+        columns > _Columns - column) {
+      matrix_view view(_Data, 0, 0, _RowStride, _ColumnStride);
+      view._Status = STATUS::BOUND_ARRAY;
+      return view;
+    }
+    return matrix_view(_Data + row * _RowStride + column * _ColumnStride, rows,
+                       columns, _RowStride, _ColumnStride);
+  }
+
+  /// @brief Get the view of transposed matrix without moving the elements.
+  constexpr matrix_view transpose() const {
+    return matrix_view(_Data, _Columns, _Rows, _ColumnStride, _RowStride);
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const matrix_view &obj) {
+    for (size_t row = 0; row < obj._Rows; row++) {
+      for (size_t col = 0; col < obj._Columns; col++)
+        os << obj.element(row, col) << ' ';
+      os << std::endl;
+    }
+    return os;
+  }
+
+  /// @brief Calculates the sum of all elements in
+  /// `accumulator_t<value_type>` by the strategy `mode`. @see summation
+  accumulator_t<value_type> sum(summation mode = summation::fast) const {
+    if (_ColumnStride == 1)
+      return detail::matrix_sum(_Data, _RowStride, _Rows, _Columns, mode);
+    detail::scratch<accumulator_t<value_type>> sums(_Rows);
+    for (size_t row = 0; row < _Rows; row++)
+      sums[row] = this->row(row).sum(mode);
+    return simd::sum(sums.data(), _Rows, mode);
+  }
+
+ private:
+  constexpr vector_view<T> empty_vector() const {
+    vector_view<T> view(_Data, 0);
+    view._Status = _Status = STATUS::BOUND_ARRAY;
+    return view;
+  }
+
+  /// @brief Computes `op(element, value)` for the elements of expression.
+  template <typename E, typename Op>
+  matrix_view &assign(const E &expression, Op op) {
+    const auto node = detail::as_matrix_node(expression);
+    if (node.rows() != _Rows || node.columns() != _Columns) {
+      _Status = STATUS::BOUND_ARRAY;
+      return *this;
+    }
+    if constexpr (std::is_same_v<Op, detail::assign_op>)
+      _Status = node.status();
+    if (!detail::evaluate_strided(_Data, _RowStride, _ColumnStride, node, op))
+      _Status = STATUS::BAD_ALLOCATOR;
+    return *this;
+  }
+};
+
+}  // namespace bez
+#endif
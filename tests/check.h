@@ -0,0 +1,48 @@
+/**
+ * @file check.h
+ * @brief Checks of the tests of the library: the failed checks are printed
+ * and counted, and the test returns their number.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#pragma once
+#ifndef BEZ_TEST_CHECK
+#define BEZ_TEST_CHECK
+
+#include <cstdio>
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the checks.
+ */
+
+namespace bez::test {
+
+/// @brief Number of the failed checks.
+inline int &failures() {
+  static int count = 0;
+  return count;
+}
+
+/// @brief Counts and prints the failed check.
+inline void check(bool condition, const char *expression, const char *file,
+                  int line) {
+  if (condition) return;
+  failures()++;
+  std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+}
+
+}  // namespace bez::test
+
+/// @brief Checks the condition and continues the test.
+#define BEZ_CHECK(condition)                                       \
+  ::bez::test::check(static_cast<bool>(condition), #condition, __FILE__, \
+                     __LINE__)
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file test_alias.cpp
+ * @brief Tests of the expressions of matrices and vectors, which read the
+ * destination by another layout: `m = m.transpose()`, `m += m.transpose()`,
+ * `v = v.slice(1, 3)` and the views assigned the same matrix or vector.
+ *
+ * @version 0.3
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <cstddef>
+
+#include "basic_matrix.h"
+#include "basic_vector.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of `=`, `+=` and `-=`.
+ * * 2026-10-14 V0.2 Added the rectangular matrices and the views.
+ * * 2026-10-14 V0.3 Added the vectors and the vector views.
+ */
+
+namespace {
+
+/// @brief Matrix of `rows` x `columns` distinct elements.
+bez::basic_matrix<double> make_matrix(size_t rows, size_t columns) {
+  bez::basic_matrix<double> matrix(rows, columns);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++)
+      matrix.at(i, j) = static_cast<double>(i * columns + j);
+  return matrix;
+}
+
+/// @brief Is `result` equal to `expected` element by element.
+bool same(const bez::basic_matrix<double> &result,
+          const bez::basic_matrix<double> &expected) {
+  return result.status() == bez::STATUS::GOOD_ALLOCATOR && result == expected;
+}
+
+void test_square(size_t n) {
+  const bez::basic_matrix<double> original = make_matrix(n, n);
+  const bez::basic_matrix<double> transposed(original.transpose());
+
+  bez::basic_matrix<double> m = original;
+  m = m.transpose();
+  BEZ_CHECK(same(m, transposed));
+
+  m = original;
+  m += m.transpose();
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(original + transposed)));
+
+  m = original;
+  m -= m.transpose();
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(original - transposed)));
+
+  m = original;
+  m = m.transpose() + m;
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(transposed + original)));
+
+  m = original;
+  m = m + m;
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(original + original)));
+}
+
+void test_rectangular(size_t rows, size_t columns) {
+  const bez::basic_matrix<double> original = make_matrix(rows, columns);
+  const bez::basic_matrix<double> transposed(original.transpose());
+
+  bez::basic_matrix<double> m = original;
+  m = m.transpose();
+  BEZ_CHECK(same(m, transposed));
+
+  m = original;
+  m = m.transpose() + m.transpose();
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(transposed + transposed)));
+}
+
+void test_views(size_t n) {
+  const bez::basic_matrix<double> original = make_matrix(n, n);
+  const bez::basic_matrix<double> transposed(original.transpose());
+
+  bez::basic_matrix<double> m = original;
+  m.transpose() = m;
+  BEZ_CHECK(same(m, transposed));
+
+  m = original;
+  m.transpose() += m;
+  BEZ_CHECK(same(m, bez::basic_matrix<double>(original + transposed)));
+
+  // The blocks of the same matrix, which are shifted by one row
+  m = original;
+  m.block(1, 0, n - 1, n) = m.block(0, 0, n - 1, n);
+  bez::basic_matrix<double> shifted = original;
+  for (size_t i = 1; i < n; i++)
+    for (size_t j = 0; j < n; j++) shifted.at(i, j) = original.at(i - 1, j);
+  BEZ_CHECK(same(m, shifted));
+}
+
+/// @brief Vector of `length` elements 0, 1, ...
+bez::basic_vector<double> make_vector(size_t length) {
+  bez::basic_vector<double> vector(length);
+  for (size_t i = 0; i < length; i++) vector[i] = static_cast<double>(i);
+  return vector;
+}
+
+void test_vectors(size_t n) {
+  const bez::basic_vector<double> original = make_vector(n);
+
+  // The expression of other length reads the memory, which is replaced
+  bez::basic_vector<double> v = original;
+  v = v.slice(n / 4, 3);
+  BEZ_CHECK(v.status() == bez::STATUS::GOOD_ALLOCATOR && v.length() == 3);
+  for (size_t i = 0; i < v.length(); i++)
+    BEZ_CHECK(v[i] == original[n / 4 + i]);
+
+  v = original;
+  v = v.slice(0, n / 2, 2) + v.slice(1, n / 2, 2);
+  BEZ_CHECK(v.length() == n / 2);
+  for (size_t i = 0; i < v.length(); i++)
+    BEZ_CHECK(v[i] == original[2 * i] + original[2 * i + 1]);
+
+  // The views of the same vector, which are shifted by one element
+  v = original;
+  v.slice(1, n - 1) = v.slice(0, n - 1);
+  BEZ_CHECK(v[0] == original[0]);
+  for (size_t i = 1; i < n; i++) BEZ_CHECK(v[i] == original[i - 1]);
+
+  v = original;
+  v.slice(0, n - 1) += v.slice(1, n - 1);
+  for (size_t i = 0; i + 1 < n; i++)
+    BEZ_CHECK(v[i] == original[i] + original[i + 1]);
+
+  v = original;
+  v.slice(0, n / 2, 2) = v.slice(0, n / 2);
+  for (size_t i = 0; i < n / 2; i++) BEZ_CHECK(v[2 * i] == original[i]);
+}
+
+}  // namespace
+
+int main() {
+  for (size_t n : {8, 40, 64, 100}) test_vectors(n);
+  for (size_t n : {1, 2, 7, 32, 33, 64, 100}) test_square(n);
+  for (size_t n : {2, 7, 33, 100}) test_views(n);
+  test_rectangular(1, 5);
+  test_rectangular(3, 40);
+  test_rectangular(65, 33);
+  return bez::test::failures();
+}
@@ -0,0 +1,98 @@
+/**
+ * @file test_gemm.cpp
+ * @brief Tests of the micro-kernels of the product: the kernels of the
+ * instruction sets give the same blocks as the portable kernel, and the
+ * blocked product is equal to the naive one.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <cstddef>
+#include <vector>
+
+#include "basic_gemm.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of the micro-kernels of AVX2 and
+ *   AVX-512.
+ */
+
+namespace {
+
+/// @brief Small integers, so the products are exact in any order.
+template <typename T>
+std::vector<T> make_values(size_t count, size_t period) {
+  std::vector<T> values(count);
+  for (size_t i = 0; i < count; i++)
+    values[i] = static_cast<T>(static_cast<int>(i % period) - 3);
+  return values;
+}
+
+template <typename T>
+void test_kernels() {
+  using traits = bez::gemm_traits<T>;
+  constexpr size_t MR = traits::MR, NR = traits::NR, ldc = NR + 3;
+  for (size_t kc : {1, 2, 3, 256})
+    for (size_t mr : {size_t{1}, MR})
+      for (size_t nr : {size_t{1}, NR - 1, NR}) {
+        const auto a = make_values<T>(kc * MR, 7);
+        const auto b = make_values<T>(kc * NR, 5);
+        const std::vector<T> c(MR * ldc, T(1));
+        auto expected = c;
+        bez::detail::micro_kernel_generic<T, MR, NR>(
+            kc, a.data(), b.data(), expected.data(), ldc, mr, nr);
+        auto result = c;
+        bez::detail::micro_kernel<T, MR, NR>(kc, a.data(), b.data(),
+                                             result.data(), ldc, mr, nr);
+        BEZ_CHECK(result == expected);
+#if defined(BEZ_SIMD_X86)
+        const bez::simd::isa level = bez::simd::active();
+        if (level == bez::simd::isa::avx2 || level == bez::simd::isa::avx512) {
+          result = c;
+          bez::detail::micro_kernel_avx2<MR, NR>(kc, a.data(), b.data(),
+                                                 result.data(), ldc, mr, nr);
+          BEZ_CHECK(result == expected);
+        }
+        if (level == bez::simd::isa::avx512) {
+          result = c;
+          bez::detail::micro_kernel_avx512<MR, NR>(kc, a.data(), b.data(),
+                                                   result.data(), ldc, mr, nr);
+          BEZ_CHECK(result == expected);
+        }
+#endif
+      }
+}
+
+template <typename T>
+void test_gemm() {
+  for (size_t m : {7, 100})
+    for (size_t n : {17, 100})
+      for (size_t k : {33, 300}) {
+        const auto a = make_values<T>(m * k, 7), b = make_values<T>(k * n, 5);
+        std::vector<T> result(m * n, T(1)), expected = result;
+        bez::gemm(m, n, k, a.data(), k, b.data(), n, result.data(), n);
+        for (size_t i = 0; i < m; i++)
+          for (size_t j = 0; j < n; j++)
+            for (size_t p = 0; p < k; p++)
+              expected[i * n + j] += a[i * k + p] * b[p * n + j];
+        BEZ_CHECK(result == expected);
+      }
+}
+
+}  // namespace
+
+int main() {
+  test_kernels<float>();
+  test_kernels<double>();
+  test_gemm<float>();
+  test_gemm<double>();
+  test_gemm<int>();
+  return bez::test::failures();
+}
@@ -0,0 +1,63 @@
+/**
+ * @file test_graph.cpp
+ * @brief Tests of the deferred computation: the launched graphs and the
+ * graphs which are dropped before they are computed.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <cstddef>
+#include <future>
+#include <vector>
+
+#include "basic_graph.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of `launch()`.
+ */
+
+namespace {
+
+/// @brief Matrix of `size` x `size` elements i + j.
+bez::basic_matrix<double> make_matrix(size_t size) {
+  bez::basic_matrix<double> matrix(size, size);
+  for (size_t i = 0; i < size; i++)
+    for (size_t j = 0; j < size; j++) matrix.at(i, j) = double(i + j);
+  return matrix;
+}
+
+// The inputs of the dropped graphs live until the exit
+const bez::basic_matrix<double> a = make_matrix(64), b = make_matrix(64);
+
+void test_launch() {
+  const bez::basic_matrix<double> expected = a * b + a;
+  const bez::deferred<double> x = a, y = b;
+  std::future<bez::basic_matrix<double>> result = (x * y + x).launch();
+  BEZ_CHECK(result.get() == expected);
+
+  std::vector<std::future<bez::basic_matrix<double>>> results =
+      bez::launch(std::vector<bez::deferred<double>>{x * y, x + y});
+  BEZ_CHECK(results[0].get() == a * b);
+  BEZ_CHECK(results[1].get() == a + b);
+}
+
+void test_dropped() {
+  // The futures are dropped, the threads are joined at the exit
+  const bez::deferred<double> x = a, y = b;
+  for (size_t i = 0; i < 16; i++) (void)(x * y * x + y).launch();
+}
+
+}  // namespace
+
+int main() {
+  test_launch();
+  test_dropped();
+  return bez::test::failures();
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_io.cpp
+ * @brief Tests of the binary files: the round trip and the damaged files,
+ * which are shorter than the header or whose header overflows the size.
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "basic_io.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of the damaged files.
+ * * 2026-10-14 V0.2 Added the damaged and misaligned offsets.
+ */
+
+namespace {
+
+const std::string path = "bez_test_io.bin";
+
+/// @brief Writes `bytes` bytes of `data` to the file.
+void write(const void *data, size_t bytes) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(static_cast<const char *>(data),
+             static_cast<std::streamsize>(bytes));
+}
+
+/// @brief Is the file rejected by load() and mapped_file.
+bool rejected() {
+  bez::basic_vector<double> vector;
+  bez::basic_matrix<double> matrix;
+  const bez::mapped_file file(path);
+  return bez::load(path, vector) == bez::STATUS::BAD_FILE &&
+         bez::load(path, matrix) == bez::STATUS::BAD_FILE &&
+         file.vector<double>().length() == 0 &&
+         file.matrix<double>().rows() == 0 &&
+         file.status() == bez::STATUS::BAD_FILE;
+}
+
+void test_round_trip() {
+  bez::basic_matrix<double> matrix(3, 5), result;
+  for (size_t i = 0; i < 3; i++)
+    for (size_t j = 0; j < 5; j++) matrix.at(i, j) = double(i * 5 + j);
+  BEZ_CHECK(bez::save(path, matrix) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(bez::load(path, result) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(result == matrix);
+  const bez::mapped_file file(path);
+  BEZ_CHECK(file.matrix<double>() == matrix);
+}
+
+void test_short() {
+  const char bytes[10] = {'B', 'E', 'Z', 'M'};
+  write(bytes, sizeof(bytes));
+  BEZ_CHECK(rejected());
+  write(bytes, 0);
+  BEZ_CHECK(rejected());
+}
+
+void test_overflow() {
+  // 2^32 x 2^32 elements of 8 bytes are 0 bytes modulo 2^64
+  bez::file_header header =
+      bez::detail::make_header<double>(2, size_t{1} << 32, size_t{1} << 32);
+  BEZ_CHECK(header.size() == 0 && !header.sized());
+  write(&header, sizeof(header));
+  BEZ_CHECK(rejected());
+
+  header = bez::detail::make_header<double>(2, 1, UINT64_MAX / 4);
+  BEZ_CHECK(!header.sized());
+  write(&header, sizeof(header));
+  BEZ_CHECK(rejected());
+}
+
+void test_vector_rows() {
+  // The vector has one row, otherwise the elements exceed its length
+  const bez::file_header header = bez::detail::make_header<double>(1, 4, 2);
+  const char zeros[512] = {};
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(zeros, sizeof(zeros));
+  file.close();
+  bez::basic_vector<double> vector;
+  BEZ_CHECK(bez::load(path, vector) == bez::STATUS::BAD_FILE);
+  const bez::mapped_file mapped(path);
+  BEZ_CHECK(mapped.vector<double>().length() == 0);
+  BEZ_CHECK(mapped.status() == bez::STATUS::BAD_FILE);
+}
+
+/// @brief Writes the header of `columns` elements at `offset` and the ones.
+void write_offset(uint64_t offset, size_t columns) {
+  bez::file_header header = bez::detail::make_header<double>(1, 1, columns);
+  header.offset = offset;
+  std::vector<char> bytes(
+      std::max<size_t>(sizeof(header), offset + columns * sizeof(double)));
+  for (size_t i = 0; i < columns; i++) {
+    const double one = 1;
+    std::memcpy(bytes.data() + offset + i * sizeof(double), &one, sizeof(one));
+  }
+  // The damaged offset points into the header, which overwrites the elements
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  write(bytes.data(), bytes.size());
+}
+
+void test_offset() {
+  // The elements in the header
+  write_offset(8, 4);
+  BEZ_CHECK(rejected());
+  write_offset(0, 16);
+  BEZ_CHECK(rejected());
+
+  // The misaligned elements are read, but aren't mapped
+  write_offset(sizeof(bez::file_header) + 1, 4);
+  bez::basic_vector<double> vector;
+  BEZ_CHECK(bez::load(path, vector) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(vector.length() == 4 && vector[3] == 1.0);
+  const bez::mapped_file mapped(path);
+  BEZ_CHECK(mapped.vector<double>().length() == 0);
+  BEZ_CHECK(mapped.status() == bez::STATUS::BAD_FILE);
+}
+
+}  // namespace
+
+int main() {
+  test_round_trip();
+  test_short();
+  test_overflow();
+  test_vector_rows();
+  test_offset();
+  std::remove(path.c_str());
+  return bez::test::failures();
+}
@@ -0,0 +1,271 @@
+/**
+ * @file test_linalg.cpp
+ * @brief Tests of the decompositions: the residuals of the solutions of LU,
+ * Cholesky and QR are small, the product of matrix and its inverse is the
+ * identity, and the determinant is equal to the known one.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "basic_linalg.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the residual tests of LU, Cholesky, QR,
+ *   `inverse()` and `det()`.
+ */
+
+namespace {
+
+/// @brief Pseudo-random elements in [-1, 1), the same on every run.
+template <typename T>
+bez::basic_matrix<T> make_matrix(size_t rows, size_t columns,
+                                 uint32_t seed) {
+  bez::basic_matrix<T> result(rows, columns);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++) {
+      seed = seed * 1664525u + 1013904223u;
+      result(i, j) = static_cast<T>(seed >> 8) / T(1 << 23) - T(1);
+    }
+  return result;
+}
+
+/// @brief A * A^T + n * I, which is symmetric positive definite.
+template <typename T>
+bez::basic_matrix<T> make_definite(size_t n, uint32_t seed) {
+  const auto a = make_matrix<T>(n, n, seed);
+  bez::basic_matrix<T> result(n, n);
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < n; j++) {
+      T total = i == j ? static_cast<T>(n) : T(0);
+      for (size_t p = 0; p < n; p++) total += a(i, p) * a(j, p);
+      result(i, j) = total;
+    }
+  return result;
+}
+
+/// @brief |A * x - b| / (|A| * |x| * n * eps) by the maximum norms.
+template <typename T>
+double residual(const bez::basic_matrix<T> &a, const bez::basic_vector<T> &x,
+                const bez::basic_vector<T> &b) {
+  double error = 0, norm = 0, length = 0;
+  for (size_t i = 0; i < a.rows(); i++) {
+    double total = -static_cast<double>(b[i]), row = 0;
+    for (size_t j = 0; j < a.columns(); j++) {
+      total += static_cast<double>(a(i, j)) * x[j];
+      row += std::abs(static_cast<double>(a(i, j)));
+    }
+    error = std::max(error, std::abs(total));
+    norm = std::max(norm, row);
+  }
+  for (size_t j = 0; j < x.length(); j++)
+    length = std::max(length, std::abs(static_cast<double>(x[j])));
+  return error / (norm * length * static_cast<double>(a.columns()) *
+                  std::numeric_limits<T>::epsilon());
+}
+
+/// @brief The column `j` of matrix.
+template <typename T>
+bez::basic_vector<T> column(const bez::basic_matrix<T> &a, size_t j) {
+  bez::basic_vector<T> result(a.rows());
+  for (size_t i = 0; i < a.rows(); i++) result[i] = a(i, j);
+  return result;
+}
+
+/// @brief Bound of the scaled residual of a backward stable solver.
+constexpr double tolerance = 10;
+
+template <typename T>
+void test_lu(size_t n) {
+  const auto a = make_matrix<T>(n, n, 1);
+  const auto b = make_matrix<T>(n, 3, 2);
+
+  auto lu = a;
+  std::vector<size_t> pivots(n);
+  BEZ_CHECK(bez::lu_factor(lu, std::span(pivots)) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  auto x = b;
+  BEZ_CHECK(bez::lu_solve(lu, std::span<const size_t>(pivots), x) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  for (size_t j = 0; j < b.columns(); j++)
+    BEZ_CHECK(residual(a, column(x, j), column(b, j)) < tolerance);
+
+  auto y = column(b, 1);
+  BEZ_CHECK(bez::lu_solve(lu, std::span<const size_t>(pivots), y) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(residual(a, y, column(b, 1)) < tolerance);
+
+  y = column(b, 2);
+  BEZ_CHECK(bez::solve(a, y) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(residual(a, y, column(b, 2)) < tolerance);
+  x = b;
+  BEZ_CHECK(bez::solve(a, x) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(residual(a, column(x, 0), column(b, 0)) < tolerance);
+
+  bez::basic_vector<T> wrong(n + 1);
+  BEZ_CHECK(bez::lu_solve(lu, std::span<const size_t>(pivots), wrong) ==
+            bez::STATUS::BOUND_ARRAY);
+  std::vector<size_t> short_pivots(n - 1);
+  BEZ_CHECK(bez::lu_factor(lu, std::span(short_pivots)) ==
+            bez::STATUS::BOUND_ARRAY);
+}
+
+template <typename T>
+void test_cholesky(size_t n) {
+  const auto a = make_definite<T>(n, 3);
+  const auto b = make_matrix<T>(n, 3, 4);
+
+  auto l = a;
+  BEZ_CHECK(bez::cholesky_factor(l) == bez::STATUS::GOOD_ALLOCATOR);
+  for (size_t i = 0; i + 1 < n; i++) BEZ_CHECK(l(i, i + 1) == T(0));
+  auto x = b;
+  BEZ_CHECK(bez::cholesky_solve(l, x) == bez::STATUS::GOOD_ALLOCATOR);
+  for (size_t j = 0; j < b.columns(); j++)
+    BEZ_CHECK(residual(a, column(x, j), column(b, j)) < tolerance);
+
+  auto y = column(b, 1);
+  BEZ_CHECK(bez::cholesky_solve(l, y) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(residual(a, y, column(b, 1)) < tolerance);
+
+  auto indefinite = a;
+  indefinite(n / 2, n / 2) = -indefinite(n / 2, n / 2);
+  BEZ_CHECK(bez::cholesky_factor(indefinite) == bez::STATUS::SINGULAR);
+}
+
+template <typename T>
+void test_qr(size_t m, size_t n) {
+  const auto a = make_matrix<T>(m, n, 5);
+  const auto b = column(make_matrix<T>(m, 1, 6), 0);
+
+  auto qr = a;
+  bez::basic_vector<T> tau(n);
+  BEZ_CHECK(bez::qr_factor(qr, tau) == bez::STATUS::GOOD_ALLOCATOR);
+  bez::basic_vector<T> x(n);
+  BEZ_CHECK(bez::qr_solve(qr, tau, b, x) == bez::STATUS::GOOD_ALLOCATOR);
+
+  // The residual of least squares is orthogonal to the columns: A^T r = 0
+  std::vector<double> r(m);
+  double norm = 0;
+  for (size_t i = 0; i < m; i++) {
+    r[i] = -static_cast<double>(b[i]);
+    for (size_t j = 0; j < n; j++)
+      r[i] += static_cast<double>(a(i, j)) * x[j];
+    norm = std::max(norm, std::abs(static_cast<double>(b[i])));
+  }
+  double error = 0;
+  for (size_t j = 0; j < n; j++) {
+    double total = 0;
+    for (size_t i = 0; i < m; i++) total += a(i, j) * r[i];
+    error = std::max(error, std::abs(total));
+  }
+  BEZ_CHECK(error < tolerance * static_cast<double>(m * n) * norm *
+                        std::numeric_limits<T>::epsilon());
+
+  // The consistent system is solved exactly up to the rounding
+  const auto solution = column(make_matrix<T>(n, 1, 7), 0);
+  bez::basic_vector<T> c(m);
+  for (size_t i = 0; i < m; i++) {
+    T total = 0;
+    for (size_t j = 0; j < n; j++) total += a(i, j) * solution[j];
+    c[i] = total;
+  }
+  BEZ_CHECK(bez::qr_solve(qr, tau, c, x) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(residual(a, x, c) < tolerance);
+
+  bez::basic_vector<T> short_tau(n - 1);
+  BEZ_CHECK(bez::qr_factor(qr, short_tau) == bez::STATUS::BOUND_ARRAY);
+}
+
+template <typename T>
+void test_inverse(size_t n) {
+  const auto a = make_matrix<T>(n, n, 8);
+  auto inverse = a;
+  BEZ_CHECK(bez::inverse(inverse) == bez::STATUS::GOOD_ALLOCATOR);
+  for (size_t j = 0; j < n; j++) {
+    bez::basic_vector<T> unit(n);
+    unit[j] = T(1);
+    BEZ_CHECK(residual(a, column(inverse, j), unit) < tolerance);
+  }
+
+  bez::basic_matrix<T> singular(n, n, T(1));
+  const auto copy = singular;
+  BEZ_CHECK(bez::inverse(singular) == bez::STATUS::SINGULAR);
+  BEZ_CHECK(singular == copy);
+}
+
+template <typename T>
+void test_det(size_t n) {
+  // The diagonal 1, 2, 1, 2, ... with the rows 0 and 1 swapped
+  bez::basic_matrix<T> a(n, n);
+  for (size_t i = 0; i < n; i++) a(i, i) = i % 2 ? T(2) : T(1);
+  for (size_t j = 0; j < n; j++) std::swap(a(0, j), a(1, j));
+  const T expected = -std::pow(T(2), static_cast<T>(n / 2));
+  BEZ_CHECK(std::abs(bez::det(a) - expected) <=
+            std::abs(expected) * std::numeric_limits<T>::epsilon() *
+                static_cast<T>(n));
+
+  // The lower unit triangular matrix times the upper triangular one, their
+  // off-diagonal elements are small, so the product is well-conditioned
+  const auto random = make_matrix<T>(n, n, 9);
+  bez::basic_matrix<T> l(n, n), u(n, n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      const T value = random(i, j) / static_cast<T>(n);
+      if (j < i) l(i, j) = value;
+      if (j > i) u(i, j) = value;
+    }
+    l(i, i) = T(1);
+    u(i, i) = i % 3 ? T(1) : T(-1.5);
+  }
+  bez::basic_matrix<T> product(n, n);
+  T known = 1;
+  for (size_t i = 0; i < n; i++) {
+    known *= u(i, i);
+    for (size_t j = 0; j < n; j++) {
+      T total = 0;
+      for (size_t p = 0; p < n; p++) total += l(i, p) * u(p, j);
+      product(i, j) = total;
+    }
+  }
+  BEZ_CHECK(std::abs(bez::det(product) - known) <=
+            std::abs(known) * T(10) * std::numeric_limits<T>::epsilon() *
+                static_cast<T>(n));
+
+  BEZ_CHECK(bez::det(bez::basic_matrix<T>(n, n + 1, T(1))) == T(0));
+  BEZ_CHECK(bez::det(bez::basic_matrix<T>(n, n, T(1))) == T(0));
+}
+
+template <typename T>
+void test_all() {
+  // The sizes are below, at and over the panel of factor_block columns
+  for (size_t n : {5, 64, 150}) {
+    test_lu<T>(n);
+    test_cholesky<T>(n);
+    test_qr<T>(n, n);
+    test_qr<T>(n + 37, n);
+    test_inverse<T>(n);
+    test_det<T>(n);
+  }
+}
+
+}  // namespace
+
+int main() {
+  test_all<float>();
+  test_all<double>();
+  return bez::test::failures();
+}
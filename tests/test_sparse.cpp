@@ -0,0 +1,251 @@
+/**
+ * @file test_sparse.cpp
+ * @brief Tests of the sparse matrices: the construction by the triplets, the
+ * conversions, the products with vectors and matrices, and the assignment of
+ * the matrices of other resources.
+ *
+ * @version 0.2
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "basic_sparse.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of the assignment.
+ * * 2026-10-14 V0.2 Implement the tests of the construction, the
+ *   conversions and the products.
+ */
+
+namespace {
+
+/// @brief Small integers on the pseudo-random positions, so the products
+/// are exact in any order. Every 7th element is repeated, the last ones are
+/// beyond the matrix.
+std::vector<bez::triplet<double>> make_elements(size_t rows, size_t columns,
+                                                size_t count) {
+  std::vector<bez::triplet<double>> result;
+  size_t seed = 1;
+  for (size_t p = 0; p < count; p++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    const bez::triplet<double> element{seed % rows, (seed / rows) % columns,
+                                       static_cast<double>(p % 9) - 4};
+    result.push_back(element);
+    if (p % 7 == 0) result.push_back({element.row, element.column, 2.0});
+  }
+  result.push_back({rows, 0, 1.0});
+  result.push_back({0, columns, 1.0});
+  return result;
+}
+
+/// @brief The dense matrix of the same elements.
+bez::basic_matrix<double> make_dense(
+    size_t rows, size_t columns,
+    const std::vector<bez::triplet<double>> &elements) {
+  bez::basic_matrix<double> result(rows, columns);
+  for (const auto &element : elements)
+    if (element.row < rows && element.column < columns)
+      result(element.row, element.column) += element.value;
+  return result;
+}
+
+bez::basic_matrix<double> naive(const bez::basic_matrix<double> &a,
+                                const bez::basic_matrix<double> &b) {
+  bez::basic_matrix<double> result(a.rows(), b.columns());
+  for (size_t i = 0; i < a.rows(); i++)
+    for (size_t j = 0; j < b.columns(); j++)
+      for (size_t p = 0; p < a.columns(); p++)
+        result(i, j) += a(i, p) * b(p, j);
+  return result;
+}
+
+bez::basic_matrix<double> make_matrix(size_t rows, size_t columns) {
+  bez::basic_matrix<double> result(rows, columns);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++)
+      result(i, j) = static_cast<double>((i * columns + j) % 5) - 2;
+  return result;
+}
+
+template <bez::sparse_format F>
+void test_construction(size_t rows, size_t columns, size_t count) {
+  const auto elements = make_elements(rows, columns, count);
+  const auto expected = make_dense(rows, columns, elements);
+  const bez::basic_sparse_matrix<double, F> a(rows, columns, elements);
+  BEZ_CHECK(a.status() == bez::STATUS::BOUND_ARRAY);
+  BEZ_CHECK(a.rows() == rows && a.columns() == columns);
+  BEZ_CHECK(a.offsets().size() ==
+            (F == bez::sparse_format::csr ? rows : columns) + 1);
+
+  // The indices are sorted and unique in every row (column)
+  bool sorted = true;
+  for (size_t i = 0; i + 1 < a.offsets().size(); i++)
+    for (size_t p = a.offsets()[i]; p + 1 < a.offsets()[i + 1]; p++)
+      sorted &= a.indices()[p] < a.indices()[p + 1];
+  BEZ_CHECK(sorted);
+  BEZ_CHECK(a.offsets().back() == a.nonzeros());
+
+  BEZ_CHECK(a.dense() == expected);
+  bool equal = true;
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++) equal &= a(i, j) == expected(i, j);
+  BEZ_CHECK(equal);
+
+  const bez::basic_sparse_matrix<double, F> inside(rows, columns,
+                                                   std::span(elements)
+                                                       .first(count));
+  BEZ_CHECK(inside.nonzeros() <= a.nonzeros());
+  BEZ_CHECK(inside.at(rows, 0) == 0);
+  BEZ_CHECK(inside.status() == bez::STATUS::BOUND_ARRAY);
+}
+
+template <bez::sparse_format F>
+void test_conversion(size_t rows, size_t columns, size_t count) {
+  const auto elements = make_elements(rows, columns, count);
+  const auto expected = make_dense(rows, columns, elements);
+  const bez::basic_sparse_matrix<double, F> a(rows, columns, elements);
+
+  constexpr bez::sparse_format G = F == bez::sparse_format::csr
+                                       ? bez::sparse_format::csc
+                                       : bez::sparse_format::csr;
+  const bez::basic_sparse_matrix<double, G> other(a);
+  BEZ_CHECK(other.nonzeros() == a.nonzeros());
+  BEZ_CHECK(other.dense() == a.dense());
+  const bez::basic_sparse_matrix<double, F> back(other);
+  BEZ_CHECK(std::ranges::equal(back.offsets(), a.offsets()));
+  BEZ_CHECK(std::ranges::equal(back.indices(), a.indices()));
+  BEZ_CHECK(std::ranges::equal(back.values(), a.values()));
+
+  const auto transposed = a.transpose();
+  bool equal = transposed.rows() == columns && transposed.columns() == rows;
+  for (size_t i = 0; equal && i < rows; i++)
+    for (size_t j = 0; j < columns; j++)
+      equal &= transposed(j, i) == expected(i, j);
+  BEZ_CHECK(equal);
+
+  const bez::basic_sparse_matrix<double, F> from_dense(expected);
+  BEZ_CHECK(from_dense.status() == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(from_dense.dense() == expected);
+}
+
+template <bez::sparse_format F>
+void test_products(size_t rows, size_t columns, size_t count) {
+  const auto elements = make_elements(rows, columns, count);
+  const auto expected = make_dense(rows, columns, elements);
+  const bez::basic_sparse_matrix<double, F> a(rows, columns, elements);
+
+  // SpMV
+  const auto x = make_matrix(columns, 1);
+  bez::basic_vector<double> vector(columns);
+  for (size_t j = 0; j < columns; j++) vector[j] = x(j, 0);
+  const auto product = naive(expected, x);
+  const bez::basic_vector<double> y = a * vector;
+  bool equal = y.length() == rows;
+  for (size_t i = 0; equal && i < rows; i++) equal &= y[i] == product(i, 0);
+  BEZ_CHECK(equal);
+
+  bez::basic_vector<double> z(rows, 1.0);
+  BEZ_CHECK(bez::gemv(2.0, a, vector, -1.0, z) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  equal = true;
+  for (size_t i = 0; i < rows; i++) equal &= z[i] == 2 * product(i, 0) - 1;
+  BEZ_CHECK(equal);
+  bez::basic_vector<double> wrong(rows + 1, 1.0);
+  BEZ_CHECK(bez::gemv(1.0, a, vector, 0.0, wrong) ==
+            bez::STATUS::BOUND_ARRAY);
+  BEZ_CHECK(wrong == bez::basic_vector<double>(rows + 1, 1.0));
+  BEZ_CHECK((a * bez::basic_vector<double>(columns + 1)).status() ==
+            bez::STATUS::BOUND_ARRAY);
+
+  // SpMM
+  const size_t n = 19;
+  const auto b = make_matrix(columns, n);
+  const auto expected_product = naive(expected, b);
+  BEZ_CHECK(a * b == expected_product);
+  BEZ_CHECK((a * make_matrix(columns + 1, n)).status() ==
+            bez::STATUS::BOUND_ARRAY);
+
+  // The transposed view is read by its strides
+  const auto bt = make_matrix(n, columns);
+  bez::basic_matrix<double> transposed(columns, n);
+  for (size_t i = 0; i < columns; i++)
+    for (size_t j = 0; j < n; j++) transposed(i, j) = bt(j, i);
+  const auto expected_transposed = naive(expected, transposed);
+  bez::basic_matrix<double> c(rows, n, 1.0);
+  BEZ_CHECK(bez::gemm(3.0, a, bt.transpose(), 2.0, c) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  equal = true;
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < n; j++)
+      equal &= c(i, j) == 3 * expected_transposed(i, j) + 2;
+  BEZ_CHECK(equal);
+
+  const auto copy = c;
+  BEZ_CHECK(bez::gemm(1.0, a, make_matrix(columns + 1, n), 0.0, c) ==
+            bez::STATUS::BOUND_ARRAY);
+  BEZ_CHECK(c == copy);
+}
+
+/// @brief The shapes and the numbers of elements of the matrices.
+struct shape {
+  size_t rows, columns, count;
+};
+constexpr shape shapes[] = {
+    {1, 1, 1}, {7, 5, 20}, {64, 100, 300}, {300, 37, 2000}};
+
+template <bez::sparse_format F>
+void test_format() {
+  for (const shape &s : shapes) {
+    test_construction<F>(s.rows, s.columns, s.count);
+    test_conversion<F>(s.rows, s.columns, s.count);
+    test_products<F>(s.rows, s.columns, s.count);
+  }
+}
+
+const std::vector<bez::triplet<double>> elements = {
+    {0, 0, 1.0}, {1, 2, 2.0}, {2, 1, 3.0}, {3, 3, 4.0}};
+
+void test_assignment() {
+  std::pmr::monotonic_buffer_resource arena;
+  const bez::csr_matrix<double> original(4, 4, elements);
+
+  // The resources are different, so the elements are copied
+  bez::csr_matrix<double> moved(1, 1, &arena);
+  bez::csr_matrix<double> other(original);
+  moved = std::move(other);
+  BEZ_CHECK(moved.status() == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(moved.dense() == original.dense());
+
+  // The memory isn't allocated: the matrix isn't changed and isn't thrown
+  std::byte buffer[64];
+  std::pmr::monotonic_buffer_resource small(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  bez::csr_matrix<double> empty(1, 1, &small);
+  other = original;
+  empty = std::move(other);
+  BEZ_CHECK(empty.status() == bez::STATUS::BAD_ALLOCATOR);
+  BEZ_CHECK(empty.rows() == 1 && empty.nonzeros() == 0);
+  empty = moved;
+  BEZ_CHECK(empty.status() == bez::STATUS::BAD_ALLOCATOR);
+}
+
+}  // namespace
+
+int main() {
+  test_format<bez::sparse_format::csr>();
+  test_format<bez::sparse_format::csc>();
+  test_assignment();
+  return bez::test::failures();
+}
@@ -0,0 +1,155 @@
+/**
+ * @file test_strassen.cpp
+ * @brief Tests of the fast multiplication: the products of Strassen-Winograd
+ * of the odd sides, which leave the odd rows and columns on each level of
+ * recursion, are equal to the classic ones.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "basic_matrix.h"
+#include "basic_strassen.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of `strassen()` and
+ *   `set_strassen_cutoff()`.
+ */
+
+namespace {
+
+/// @brief Small integers, so the products are exact in any order.
+template <typename T>
+bez::basic_matrix<T> make_matrix(size_t rows, size_t columns, size_t period) {
+  bez::basic_matrix<T> result(rows, columns);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++)
+      result(i, j) = static_cast<T>(static_cast<int>((i * columns + j) %
+                                                     period) -
+                                    3);
+  return result;
+}
+
+template <typename T>
+bez::basic_matrix<T> naive(const bez::basic_matrix<T> &a,
+                           const bez::basic_matrix<T> &b) {
+  bez::basic_matrix<T> result(a.rows(), b.columns());
+  for (size_t i = 0; i < a.rows(); i++)
+    for (size_t j = 0; j < b.columns(); j++) {
+      T total = 0;
+      for (size_t p = 0; p < a.columns(); p++) total += a(i, p) * b(p, j);
+      result(i, j) = total;
+    }
+  return result;
+}
+
+/// @brief The sides, which are odd on several levels of recursion of 8.
+struct shape {
+  size_t m, n, k;
+};
+constexpr shape shapes[] = {{33, 35, 37}, {65, 63, 67}, {71, 16, 129},
+                            {16, 16, 16}, {15, 99, 17}};
+constexpr size_t cutoff = 8;
+
+template <typename T>
+void test_operator() {
+  for (const shape &s : shapes) {
+    const auto a = make_matrix<T>(s.m, s.k, 7);
+    const auto b = make_matrix<T>(s.k, s.n, 5);
+    const auto expected = naive(a, b);
+
+    bez::set_strassen_cutoff(0);
+    BEZ_CHECK(a * b == expected);
+
+    bez::set_strassen_cutoff(cutoff);
+    BEZ_CHECK(bez::strassen_cutoff() == cutoff);
+    BEZ_CHECK(a * b == expected);
+
+    // The transposed operands are multiplied by their strides
+    const auto at = make_matrix<T>(s.k, s.m, 7);
+    const auto bt = make_matrix<T>(s.n, s.k, 5);
+    bez::basic_matrix<T> product = at.transpose() * bt.transpose();
+    bez::set_strassen_cutoff(0);
+    BEZ_CHECK(product == at.transpose() * bt.transpose());
+  }
+}
+
+template <typename T>
+void test_direct() {
+  for (const shape &s : shapes)
+    for (size_t leaf : {size_t{1}, size_t{4}, cutoff}) {
+      const auto a = make_matrix<T>(s.m, s.k, 7);
+      const auto b = make_matrix<T>(s.k, s.n, 5);
+      const auto expected = naive(a, b);
+      const size_t ldc = s.n + 3;
+
+      std::vector<T> c(s.m * ldc, T(-1));
+      bez::strassen(s.m, s.n, s.k, a.data(), a.stride(), size_t{1}, b.data(),
+                    b.stride(), size_t{1}, c.data(), ldc, leaf);
+      bool equal = true;
+      for (size_t i = 0; i < s.m; i++) {
+        for (size_t j = 0; j < s.n; j++)
+          equal &= c[i * ldc + j] == expected(i, j);
+        for (size_t j = s.n; j < ldc; j++) equal &= c[i * ldc + j] == T(-1);
+      }
+      BEZ_CHECK(equal);
+
+      // Without the workspace the product is computed by the classic kernel
+      std::fill(c.begin(), c.end(), T(-1));
+      bez::strassen(s.m, s.n, s.k, a.data(), a.stride(), size_t{1}, b.data(),
+                    b.stride(), size_t{1}, c.data(), ldc, leaf,
+                    std::pmr::null_memory_resource());
+      equal = true;
+      for (size_t i = 0; i < s.m; i++)
+        for (size_t j = 0; j < s.n; j++)
+          equal &= c[i * ldc + j] == expected(i, j);
+      BEZ_CHECK(equal);
+    }
+}
+
+/// @brief The rounding errors of the real elements are within the bound of
+/// Strassen-Winograd. @see basic_strassen.h
+void test_accuracy() {
+  const size_t m = 97, n = 101, k = 103;
+  bez::basic_matrix<double> a(m, k), b(k, n);
+  for (size_t i = 0; i < m; i++)
+    for (size_t j = 0; j < k; j++) a(i, j) = std::sin(double(i * k + j));
+  for (size_t i = 0; i < k; i++)
+    for (size_t j = 0; j < n; j++) b(i, j) = std::cos(double(i * n + j));
+  const auto expected = naive(a, b);
+
+  bez::set_strassen_cutoff(cutoff);
+  const auto product = a * b;
+  bez::set_strassen_cutoff(0);
+  double error = 0;
+  for (size_t i = 0; i < m; i++)
+    for (size_t j = 0; j < n; j++)
+      error = std::max(error, std::abs(product(i, j) - expected(i, j)));
+  // 103 / 8 gives 3 levels, (2^3)^log2(18) * (8^2 + 6 * 8) - 6 * 103
+  const double bound = (18.0 * 18 * 18 * 112 - 618) * 0x1p-53;
+  BEZ_CHECK(error <= bound);
+}
+
+}  // namespace
+
+int main() {
+  test_operator<float>();
+  test_operator<double>();
+  test_direct<float>();
+  test_direct<double>();
+  test_accuracy();
+  bez::set_strassen_cutoff(0);
+  return bez::test::failures();
+}
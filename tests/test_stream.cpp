@@ -0,0 +1,54 @@
+/**
+ * @file test_stream.cpp
+ * @brief Tests of the streaming of the binary files by chunks.
+ *
+ * @version 0.1
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "basic_stream.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the tests of `stream_sum()`.
+ */
+
+namespace {
+
+const std::string path = "bez_test_stream.bin";
+
+void test_sum() {
+  bez::basic_vector<double> vector(1000);
+  for (size_t i = 0; i < vector.length(); i++) vector[i] = double(i);
+  BEZ_CHECK(bez::save(path, vector) == bez::STATUS::GOOD_ALLOCATOR);
+  double total = 0;
+  BEZ_CHECK(bez::stream_sum(path, total, 64) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(total == 999.0 * 1000.0 / 2.0);
+}
+
+void test_sum_reduced() {
+  // The sum of float16 stops at 2048, when the chunks of 1 are added to it
+  bez::basic_vector<bez::float16> vector(4096, bez::float16(1.0f));
+  BEZ_CHECK(bez::save(path, vector) == bez::STATUS::GOOD_ALLOCATOR);
+  bez::float16 total(0.0f);
+  BEZ_CHECK(bez::stream_sum(path, total, 1) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(float(total) == 4096.0f);
+}
+
+}  // namespace
+
+int main() {
+  test_sum();
+  test_sum_reduced();
+  std::remove(path.c_str());
+  return bez::test::failures();
+}
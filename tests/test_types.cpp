@@ -0,0 +1,166 @@
+/**
+ * @file test_types.cpp
+ * @brief Compile check of every type of `bez::number` on the public API of
+ * basic_vector and basic_matrix: the classes are instantiated explicitly and
+ * the free operations and the operations of basic_blas.h are called for
+ * each type.
+ *
+ * @version 0.4
+ *
+ * @date 2026-10-14
+ * @author bezlikiy (nevedrb@gmail.com, bezlikiy@github.com)
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include "basic_blas.h"
+#include "basic_matrix.h"
+#include "basic_precision.h"
+#include "basic_vector.h"
+#include "check.h"
+
+/* Changes ----------------------------------------------------------
+ * ===================================================================
+ * * 2026-10-14 V0.1 Implement the check of vectors and matrices.
+ * * 2026-10-14 V0.2 Added the operations of basic_blas.h.
+ * * 2026-10-14 V0.3 Added `sum()` of the strided views and the parallel
+ *   reductions of `bool`.
+ * * 2026-10-14 V0.4 Added `/=` of matrices.
+ */
+
+#define BEZ_INSTANTIATE(T)            \
+  template class bez::basic_vector<T>; \
+  template class bez::basic_matrix<T>;
+
+BEZ_INSTANTIATE(bool)
+BEZ_INSTANTIATE(short)
+BEZ_INSTANTIATE(unsigned short)
+BEZ_INSTANTIATE(int)
+BEZ_INSTANTIATE(unsigned)
+BEZ_INSTANTIATE(long)
+BEZ_INSTANTIATE(unsigned long)
+BEZ_INSTANTIATE(long long)
+BEZ_INSTANTIATE(unsigned long long)
+BEZ_INSTANTIATE(float)
+BEZ_INSTANTIATE(double)
+BEZ_INSTANTIATE(long double)
+BEZ_INSTANTIATE(bez::float16)
+BEZ_INSTANTIATE(bez::bfloat16)
+BEZ_INSTANTIATE(bez::int8)
+
+namespace {
+
+template <typename T>
+void test_vector() {
+  bez::basic_vector<T> a(4), b(4);
+  for (size_t i = 0; i < 4; i++) {
+    a[i] = static_cast<T>(i % 2);
+    b[i] = static_cast<T>((i + 1) % 2);
+  }
+  BEZ_CHECK(bez::multiset_equal(a, b));
+  BEZ_CHECK(bez::multiset_equal(a + b, b + a));
+  const bez::basic_vector<T> difference = a - a;
+  BEZ_CHECK(difference == bez::basic_vector<T>(4));
+  BEZ_CHECK(a.sum() == b.sum());
+  (void)a.dot(b);
+  // The strided views gather the elements for the kernels
+  (void)a.slice(0, 2, 2).sum();
+  (void)a.slice(0, 2, 2).sum(bez::summation::kahan);
+  (void)a.slice(0, 2, 2).sum(bez::summation::pairwise);
+}
+
+template <typename T>
+void test_matrix() {
+  bez::basic_matrix<T> a(3, 4), b(4, 2);
+  const bez::basic_matrix<T> product = a * b;
+  BEZ_CHECK(product == bez::basic_matrix<T>(3, 2));
+  const bez::basic_matrix<T> transposed(a.transpose());
+  BEZ_CHECK(transposed.rows() == 4 && transposed.columns() == 3);
+  a += a;
+  a -= a;
+  bez::basic_matrix<T> ones(3, 5, T(1));
+  ones /= T(1);
+  BEZ_CHECK(ones == bez::basic_matrix<T>(3, 5, T(1)));
+  ones /= T(0);
+  BEZ_CHECK(ones.status() == bez::STATUS::DIVIDED_ZERO);
+  (void)a.sum();
+  (void)a.transpose().sum();
+  (void)a.transpose().sum(bez::summation::kahan);
+  (void)a.row_sums();
+  (void)a.column_sums();
+  (void)a.row_maxima();
+  (void)a.column_minima();
+  (void)a.row_means();
+  (void)a.column_norms();
+}
+
+/// @brief y = A * x and C = A * B of all paths of `gemv`: the contiguous
+/// rows, the contiguous columns and the strided view.
+template <typename T>
+void test_blas() {
+  bez::basic_matrix<T> a(3, 3, T(1)), c(3, 3);
+  bez::basic_vector<T> x(3), y(3);
+  for (size_t i = 0; i < 3; i++) x[i] = T(1);
+  const bez::basic_vector<T> expected = x * T(3);
+
+  BEZ_CHECK(bez::gemv(T(1), a, x, T(0), y) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(y == expected);
+  BEZ_CHECK(bez::gemv(T(1), a.transpose(), x, T(0), y) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(y == expected);
+  bez::basic_matrix<T> wide(3, 6, T(1));
+  const auto strided = bez::matrix_view<const T>(wide.data(), 3, 3,
+                                                 wide.stride(), 2);
+  BEZ_CHECK(bez::gemv(T(1), strided, x, T(0), y) ==
+            bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(y == expected);
+
+  BEZ_CHECK(bez::gemm(T(1), a, a, T(0), c) == bez::STATUS::GOOD_ALLOCATOR);
+  BEZ_CHECK(bez::axpy(T(1), x, y) == bez::STATUS::GOOD_ALLOCATOR);
+  bez::scal(T(1), y);
+  (void)bez::dot(x, y);
+}
+
+/// @brief min() and max() of `bool` longer than `parallel_threshold()`,
+/// whose ranges are reduced by the threads of the pool.
+void test_parallel_bool() {
+  bez::basic_vector<bool> v(bez::parallel_threshold() * 4);
+  for (size_t i = 0; i < v.length(); i += 3) v[i] = true;
+  BEZ_CHECK(v.min() == false && v.max() == true);
+  BEZ_CHECK(v.view().min() == false && v.view().max() == true);
+}
+
+/// @brief `/=` of the matrix of many rows, which are divided by the threads.
+void test_parallel_divide() {
+  const size_t rows = 301, columns = 203;
+  bez::basic_matrix<double> a(rows, columns), expected(rows, columns);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < columns; j++) {
+      a(i, j) = static_cast<double>(i * columns + j);
+      expected(i, j) = a(i, j) / 4;
+    }
+  a /= 4.0;
+  BEZ_CHECK(a == expected);
+}
+
+template <typename... T>
+void test_all() {
+  (test_vector<T>(), ...);
+  (test_matrix<T>(), ...);
+  (test_blas<T>(), ...);
+}
+
+}  // namespace
+
+int main() {
+  test_all<bool, short, unsigned short, int, unsigned, long, unsigned long,
+           long long, unsigned long long, float, double, long double,
+           bez::float16, bez::bfloat16, bez::int8>();
+  bez::set_num_threads(4);
+  test_parallel_bool();
+  test_parallel_divide();
+  return bez::test::failures();
+}